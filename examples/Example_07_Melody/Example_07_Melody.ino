@@ -71,8 +71,8 @@ void play_melody()
     // to calculate the note duration, take one second divided by the note type.
     //e.g. quarter note = 1000 / 4, eighth note = 1000/8, etc.
     int noteDuration = 1000 / noteDurations[thisNote];
-    buzzer.configureBuzzer(melody[thisNote], noteDuration, SFE_QWIIC_BUZZER_VOLUME_MAX);
-    buzzer.on();
+    // play() configures the buzzer and turns it on in a single I2C transaction
+    buzzer.play(melody[thisNote], noteDuration, SFE_QWIIC_BUZZER_VOLUME_MAX);
 
     // to distinguish the notes, set a minimum time between them.
     // the note's duration + 30% seems to work well:
@@ -0,0 +1,83 @@
+/******************************************************************************
+  Example_11_Sound_Effects_NonBlocking
+
+  This example plays the sound effects included in this library without
+  blocking the rest of your sketch.
+
+  startSoundEffect() returns right away, and the effect is played by calling
+  update() from loop(). The buzzer is only written to when the next step of
+  the effect is due, so the rest of loop() keeps running while it plays.
+  Here, we blink the built-in LED to show that loop() is never stalled.
+
+  The steps of the effects are timed by the buzzer itself, so if loop() ever
+  does get held up, the buzzer still goes quiet on time.
+
+  See Example_08_Sound_Effects for a description of each sound effect.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzer
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+QwiicBuzzer buzzer;
+
+#define BUZZER_VOLUME 3 // pretty good volume for most things
+
+uint8_t soundEffect = 0;
+unsigned long nextEffectTime = 0;
+unsigned long nextBlinkTime = 0;
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_11_Sound_Effects_NonBlocking");
+  Wire.begin(); //Join I2C bus
+  Wire.setClock(400000); // sound effects require changing configuration quickly
+
+  pinMode(LED_BUILTIN, OUTPUT);
+
+  //check if buzzer will connect over I2C
+  if (buzzer.begin() == false) {
+    Serial.println("Device did not connect! Freezing.");
+    while (1);
+  }
+  Serial.println("Buzzer connected.");
+
+  // Give each step of the effects its duration, so the buzzer turns itself
+  // off even if loop() gets held up
+  buzzer.setEffectTiming(kSfeQwiicBuzzerTimingDevice);
+}
+
+void loop() {
+  unsigned long now = millis();
+
+  // Start the next sound effect, 2 seconds after the last one finished
+  if (buzzer.isPlaying() == false && now >= nextEffectTime) {
+    Serial.print("Sound Effect: ");
+    Serial.println(soundEffect);
+    buzzer.startSoundEffect(soundEffect, BUZZER_VOLUME);
+    soundEffect = (soundEffect + 1) % 10;
+  }
+
+  // Play the next step of the sound effect, if it is due
+  if (buzzer.update(now) != 0) {
+    Serial.println("error!");
+  }
+
+  if (buzzer.isPlaying() == true) {
+    nextEffectTime = now + 2000;
+  }
+
+  // Meanwhile, the rest of the sketch keeps running
+  if (now >= nextBlinkTime) {
+    digitalWrite(LED_BUILTIN, !digitalRead(LED_BUILTIN));
+    nextBlinkTime = now + 100;
+  }
+}
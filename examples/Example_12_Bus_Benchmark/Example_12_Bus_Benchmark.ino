@@ -0,0 +1,146 @@
+/******************************************************************************
+  Example_12_Bus_Benchmark
+
+  This example measures the I2C bus cost of the sound effects and of a few
+  reference melodies, so different versions of the library can be compared.
+
+  No buzzer is needed: everything is played on an emulated Qwiic Buzzer
+  (sfDevBuzzerMockBus), which counts transactions and bytes, and works out
+  how long each one would take on a real bus. Time is simulated too, so the
+  whole benchmark runs in a fraction of a second.
+
+  Each sound effect and melody is played at 100KHz, 400KHz and 1MHz, and the
+  results are printed as CSV, one line per run:
+    name        - sound effect number, or melody name
+    clock_hz    - simulated I2C clock
+    transactions- number of I2C transactions
+    bytes       - bytes on the wire (addresses, register pointers and data)
+    bus_us      - time the bus was busy, in microseconds
+    play_ms     - length of the sound, in milliseconds
+
+  The same benchmark builds on a host computer, and writes the CSV to a
+  file: see extras/host/benchmark/busBenchmark.cpp.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  None, the buzzer is emulated.
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+#include <sfTk/sfDevBuzzerMockBus.h>
+
+sfDevBuzzerMockBus mockBus;
+sfDevBuzzer buzzer;
+
+#define BUZZER_VOLUME 3
+
+const uint32_t clocks[] = {100000, 400000, 1000000};
+
+// The melody of Example_07_Melody
+const uint16_t melodyExample07[] = {
+  SFE_QWIIC_BUZZER_NOTE_C4, SFE_QWIIC_BUZZER_NOTE_G3, SFE_QWIIC_BUZZER_NOTE_G3, SFE_QWIIC_BUZZER_NOTE_A3,
+  SFE_QWIIC_BUZZER_NOTE_G3, SFE_QWIIC_BUZZER_NOTE_REST, SFE_QWIIC_BUZZER_NOTE_B3, SFE_QWIIC_BUZZER_NOTE_C4};
+const uint8_t durationsExample07[] = {4, 8, 8, 4, 4, 4, 4, 4};
+
+// A C major scale in sixteenth notes
+const uint16_t melodyScale[] = {
+  SFE_QWIIC_BUZZER_NOTE_C5, SFE_QWIIC_BUZZER_NOTE_D5, SFE_QWIIC_BUZZER_NOTE_E5, SFE_QWIIC_BUZZER_NOTE_F5,
+  SFE_QWIIC_BUZZER_NOTE_G5, SFE_QWIIC_BUZZER_NOTE_A5, SFE_QWIIC_BUZZER_NOTE_B5, SFE_QWIIC_BUZZER_NOTE_C6};
+const uint8_t durationsScale[] = {16, 16, 16, 16, 16, 16, 16, 16};
+
+// The same note over and over, as an alarm would
+const uint16_t melodyAlarm[] = {
+  SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6,
+  SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6};
+const uint8_t durationsAlarm[] = {8, 8, 8, 8, 8, 8, 8, 8};
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_12_Bus_Benchmark");
+
+  if (buzzer.begin(&mockBus) != 0) {
+    Serial.println("Emulated device did not connect! Freezing.");
+    while (1);
+  }
+
+  Serial.println("name,clock_hz,transactions,bytes,bus_us,play_ms");
+
+  for (uint8_t c = 0; c < sizeof(clocks) / sizeof(clocks[0]); c++) {
+    mockBus.setClock(clocks[c]);
+
+    for (uint8_t effect = 0; effect < SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT; effect++) {
+      String name = "effect";
+      benchmarkSoundEffect(name + effect, effect);
+    }
+
+    benchmarkMelody("melody_example07", melodyExample07, durationsExample07, sizeof(durationsExample07));
+    benchmarkMelody("melody_scale", melodyScale, durationsScale, sizeof(durationsScale));
+    benchmarkMelody("melody_alarm", melodyAlarm, durationsAlarm, sizeof(durationsAlarm));
+  }
+  Serial.println("done");
+}
+
+void loop() {
+  // do nothing
+  // the benchmark runs once during setup above.
+}
+
+// Plays a sound effect with the non-blocking player, moving the simulated
+// time forward one millisecond at a time
+void benchmarkSoundEffect(const String &name, uint8_t effect)
+{
+  // Start from an unknown device state, as a fresh call would
+  buzzer.invalidateCache();
+  mockBus.resetStats();
+
+  uint32_t playMs = 0;
+  buzzer.startSoundEffect(effect, BUZZER_VOLUME);
+  while (buzzer.isPlaying()) {
+    buzzer.update(playMs);
+    if (buzzer.isPlaying()) {
+      mockBus.advanceTime(1);
+      playMs++;
+    }
+  }
+  report(name, playMs);
+}
+
+// Plays a melody the way Example_07_Melody does
+void benchmarkMelody(const String &name, const uint16_t *melody, const uint8_t *durations, uint8_t length)
+{
+  buzzer.invalidateCache();
+  mockBus.resetStats();
+
+  uint32_t playMs = 0;
+  for (uint8_t i = 0; i < length; i++) {
+    uint16_t noteDuration = 1000 / durations[i];
+    buzzer.play(melody[i], noteDuration, SFE_QWIIC_BUZZER_VOLUME_MAX);
+
+    uint16_t pauseBetweenNotes = noteDuration * 13 / 10;
+    mockBus.advanceTime(pauseBetweenNotes);
+    playMs += pauseBetweenNotes;
+  }
+  report(name, playMs);
+}
+
+void report(const String &name, uint32_t playMs)
+{
+  Serial.print(name);
+  Serial.print(",");
+  Serial.print(mockBus.clock());
+  Serial.print(",");
+  Serial.print(mockBus.transactions());
+  Serial.print(",");
+  Serial.print(mockBus.wireBytes());
+  Serial.print(",");
+  Serial.print(mockBus.busTimeUs());
+  Serial.print(",");
+  Serial.println(playMs);
+}
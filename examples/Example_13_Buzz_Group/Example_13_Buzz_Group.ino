@@ -0,0 +1,65 @@
+/******************************************************************************
+  Example_13_Buzz_Group
+
+  This example shows how to start several buzzers at the same time.
+
+  Turning buzzers on one after another with configureBuzzer() and on() adds
+  two I2C transactions of delay per buzzer. A QwiicBuzzerGroup loads the
+  tone, volume and duration into every buzzer ahead of time, so that starting
+  them is only a quick burst of ACTIVE writes. It also measures the skew
+  between the first and the last buzzer starting.
+
+  Note, you must use the ChangeI2CAddress example to give each buzzer its own
+  address. Here, we are using 0x34 (the default), 0x5B and 0x5C.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzers
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+
+const uint8_t addresses[] = {SFE_QWIIC_BUZZER_DEFAULT_ADDRESS, 0x5B, 0x5C};
+const uint8_t numberOfBuzzers = sizeof(addresses) / sizeof(addresses[0]);
+
+QwiicBuzzer buzzers[numberOfBuzzers];
+QwiicBuzzerGroup group;
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_13_Buzz_Group");
+  Wire.begin(); //Join I2C bus
+  Wire.setClock(400000); // a faster bus means a tighter start
+
+  for (uint8_t i = 0; i < numberOfBuzzers; i++) {
+    //check if buzzer will connect over I2C
+    if (buzzers[i].begin(addresses[i]) == false) {
+      Serial.print("Device 0x");
+      Serial.print(addresses[i], HEX);
+      Serial.println(" did not connect! Freezing.");
+      while (1);
+    }
+    group.add(&buzzers[i]);
+  }
+  Serial.println("Buzzers connected.");
+}
+
+void loop() {
+  // Load the next note into every buzzer, in silence
+  group.configureBuzzer(SFE_QWIIC_BUZZER_NOTE_A5, 200, SFE_QWIIC_BUZZER_VOLUME_MID);
+
+  // Start them all together
+  group.on();
+
+  Serial.print("Start skew (us): ");
+  Serial.println(group.skewUs());
+
+  delay(1000);
+}
@@ -0,0 +1,75 @@
+/******************************************************************************
+  Example_14_Melody_Packed
+
+  This example plays the melody of Example_07_Melody from the packed melody
+  format, without blocking the rest of the sketch.
+
+  Each event of a packed melody is 1 or 2 bytes: the index of the note, and
+  its duration (a whole note, a half note, a quarter note...). When a note has
+  the same duration as the one before it, the duration byte is left out. The
+  melody below is 12 bytes, and stays in program memory.
+
+  The player is started with start(), and played by calling update() from
+  loop(). While a note plays, the player already prepares the next one, so
+  when it is due, a single I2C write is all it takes.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzer
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+QwiicBuzzer buzzer;
+
+// notes in the melody, and their durations
+const uint8_t melody[] SFE_QWIIC_BUZZER_PROGMEM = {
+  sfDevBuzzerNoteIndex(kSfeQwiicBuzzerC, 4), SFE_QWIIC_BUZZER_MELODY_QUARTER,
+  sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 3), SFE_QWIIC_BUZZER_MELODY_EIGHTH,
+  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 3),
+  sfDevBuzzerNoteIndex(kSfeQwiicBuzzerA, 3), SFE_QWIIC_BUZZER_MELODY_QUARTER,
+  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 3),
+  SFE_QWIIC_BUZZER_MELODY_SAME | SFE_QWIIC_BUZZER_MELODY_REST,  // silence (aka "rest")
+  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerB, 3),
+  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerC, 4),
+  SFE_QWIIC_BUZZER_MELODY_END
+};
+
+sfDevBuzzerMelodyArray melodySource(melody, sizeof(melody));
+sfDevBuzzerMelodyPlayer player;
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_14_Melody_Packed");
+  Wire.begin(); //Join I2C bus
+
+  //check if buzzer will connect over I2C
+  if (buzzer.begin() == false) {
+    Serial.println("Device did not connect! Freezing.");
+    while (1);
+  }
+  Serial.println("Buzzer connected.");
+
+  Serial.println("Buzzing Melody now...");
+  player.start(&buzzer, &melodySource, SFE_QWIIC_BUZZER_VOLUME_MAX);
+}
+
+void loop() {
+  // Play the next note, if it is due
+  player.update(millis());
+
+  // Play the melody again, 2 seconds after it ends
+  static unsigned long restartTime = 0;
+  if (player.isPlaying() == true) {
+    restartTime = millis() + 2000;
+  } else if (millis() >= restartTime) {
+    melodySource.rewind();
+    player.start(&buzzer, &melodySource, SFE_QWIIC_BUZZER_VOLUME_MAX);
+  }
+}
@@ -0,0 +1,69 @@
+/******************************************************************************
+  Example_15_RTTTL
+
+  This example plays melodies written as RTTTL (ring tone text), like the
+  ring tones of old mobile phones.
+
+  The first melody is turned into the packed melody format when the sketch is
+  compiled, so the text isn't stored on the Arduino, and nothing needs to be
+  parsed while it plays.
+
+  Melodies can also be sent over the serial monitor (set it to "Newline"), for
+  example:
+  Beep:d=8,o=6,b=140:c,p,c,p,4g
+
+  These are parsed as they play.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzer
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+QwiicBuzzer buzzer;
+
+// Parsed when the sketch is compiled
+SFE_QWIIC_BUZZER_RTTTL(tune, "Tune:d=4,o=5,b=100:8e6,8e6,8p,8e6,8p,8c6,8e6,8p,g6,p,g");
+
+sfDevBuzzerMelodyArray tuneSource(tune::data, sizeof(tune::data));
+
+// Parsed as they play
+QwiicBuzzerMelodyStream serialStream(Serial);
+sfDevBuzzerRtttlSource serialSource(&serialStream);
+
+sfDevBuzzerMelodyPlayer player;
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_15_RTTTL");
+  Wire.begin(); //Join I2C bus
+
+  //check if buzzer will connect over I2C
+  if (buzzer.begin() == false) {
+    Serial.println("Device did not connect! Freezing.");
+    while (1);
+  }
+  Serial.println("Buzzer connected.");
+
+  Serial.println("Buzzing Melody now...");
+  player.start(&buzzer, &tuneSource, SFE_QWIIC_BUZZER_VOLUME_MAX, tune::wholeNoteMs);
+}
+
+void loop() {
+  // Play the next note, if it is due
+  player.update(millis());
+
+  // Play melodies sent over the serial monitor, once the current one is over
+  if (player.isPlaying() == false && Serial.available() > 0) {
+    Serial.println("Buzzing RTTTL from the serial monitor...");
+    serialSource.rewind();
+    player.start(&buzzer, &serialSource, SFE_QWIIC_BUZZER_VOLUME_MAX);
+  }
+}
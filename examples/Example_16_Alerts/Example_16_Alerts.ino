@@ -0,0 +1,75 @@
+/******************************************************************************
+  Example_16_Alerts
+
+  This example shares one buzzer between several alerts, each with a priority.
+
+  A short "yes" plays every 5 seconds as a heartbeat. Sending anything over the
+  serial monitor raises an alarm, with a higher priority: it interrupts the
+  heartbeat, which is dropped. A slow siren plays in the background with the
+  lowest priority; when an alert interrupts it, it resumes where it was
+  afterwards.
+
+  Alerts are queued with post(), which never touches the I2C bus, and played
+  by calling update() from loop().
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzer
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+QwiicBuzzer buzzer;
+
+sfDevBuzzerAlerts alerts;
+
+// Priorities, higher plays first
+const uint8_t kPrioritySiren = 1;
+const uint8_t kPriorityHeartbeat = 2;
+const uint8_t kPriorityAlarm = 3;
+
+unsigned long lastHeartbeat = 0;
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_16_Alerts");
+  Wire.begin(); //Join I2C bus
+
+  //check if buzzer will connect over I2C
+  if (buzzer.begin() == false) {
+    Serial.println("Device did not connect! Freezing.");
+    while (1);
+  }
+  Serial.println("Buzzer connected.");
+
+  alerts.begin(&buzzer);
+
+  // Sound effect 0 is the siren
+  alerts.post(kSfeQwiicBuzzerSoundEffects[0], kPrioritySiren, SFE_QWIIC_BUZZER_VOLUME_MIN,
+              kSfeQwiicBuzzerAlertResume);
+}
+
+void loop() {
+  // Heartbeat: sound effect 2, robot saying "Yes"
+  if (millis() - lastHeartbeat >= 5000) {
+    lastHeartbeat = millis();
+    alerts.post(kSfeQwiicBuzzerSoundEffects[2], kPriorityHeartbeat, SFE_QWIIC_BUZZER_VOLUME_LOW);
+  }
+
+  // Alarm: sound effect 9, crying robot faster
+  if (Serial.available() > 0) {
+    while (Serial.available() > 0)
+      Serial.read();
+    Serial.println("Alarm!");
+    alerts.post(kSfeQwiicBuzzerSoundEffects[9], kPriorityAlarm, SFE_QWIIC_BUZZER_VOLUME_MAX);
+  }
+
+  // Play the alerts
+  alerts.update(millis());
+}
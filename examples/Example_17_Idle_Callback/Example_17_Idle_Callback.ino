@@ -0,0 +1,67 @@
+/******************************************************************************
+  Example_17_Idle_Callback
+
+  This example plays a scale, starting each note as soon as the buzzer reports
+  that the previous one has ended.
+
+  Each note is played with a duration, so the buzzer turns itself off. With an
+  idle callback set, update() waits until the duration has elapsed, then reads
+  the buzzer's ACTIVE register until it reports that it is off, and calls the
+  callback. The callback plays the next note.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzer
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+QwiicBuzzer buzzer;
+
+// notes of the scale
+const uint16_t scale[] = {
+  SFE_QWIIC_BUZZER_NOTE_C4, SFE_QWIIC_BUZZER_NOTE_D4, SFE_QWIIC_BUZZER_NOTE_E4, SFE_QWIIC_BUZZER_NOTE_F4,
+  SFE_QWIIC_BUZZER_NOTE_G4, SFE_QWIIC_BUZZER_NOTE_A4, SFE_QWIIC_BUZZER_NOTE_B4, SFE_QWIIC_BUZZER_NOTE_C5
+};
+const uint8_t scaleLength = sizeof(scale) / sizeof(scale[0]);
+
+uint8_t nextNote = 0;
+
+// Called by buzzer.update() when the last note has ended
+void playNextNote(sfDevBuzzer *theBuzzer, void *context) {
+  if (nextNote < scaleLength) {
+    theBuzzer->play(scale[nextNote], 200, SFE_QWIIC_BUZZER_VOLUME_MAX);
+    nextNote++;
+  } else {
+    Serial.println("Scale done.");
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_17_Idle_Callback");
+  Wire.begin(); //Join I2C bus
+
+  //check if buzzer will connect over I2C
+  if (buzzer.begin() == false) {
+    Serial.println("Device did not connect! Freezing.");
+    while (1);
+  }
+  Serial.println("Buzzer connected.");
+
+  buzzer.setIdleCallback(playNextNote);
+
+  // Play the first note, the callback plays the others
+  playNextNote(&buzzer, nullptr);
+}
+
+void loop() {
+  // Checks for the end of the note, and calls playNextNote() when it is over
+  buzzer.update(millis());
+}
@@ -0,0 +1,74 @@
+/******************************************************************************
+  Example_18_Read_Config
+
+  This example reads every register of the Qwiic Buzzer in a single I2C
+  transaction with readConfig(), prints them, and changes the volume with
+  writeConfig(), which only writes the fields that changed.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzer
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+QwiicBuzzer buzzer;
+
+sfDevBuzzerConfig config;
+
+void printConfig() {
+  Serial.print("Device ID: 0x");
+  Serial.println(config.deviceId, HEX);
+  Serial.print("Firmware Version: ");
+  Serial.print(config.firmwareMajor);
+  Serial.print(".");
+  Serial.println(config.firmwareMinor);
+  Serial.print("Tone Frequency: ");
+  Serial.println(config.toneFrequency);
+  Serial.print("Volume: ");
+  Serial.println(config.volume);
+  Serial.print("Duration: ");
+  Serial.println(config.duration);
+  Serial.print("Active: ");
+  Serial.println(config.active);
+  Serial.print("I2C Address: 0x");
+  Serial.println(config.address, HEX);
+}
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_18_Read_Config");
+  Wire.begin(); //Join I2C bus
+
+  //check if buzzer will connect over I2C
+  if (buzzer.begin() == false) {
+    Serial.println("Device did not connect! Freezing.");
+    while (1);
+  }
+  Serial.println("Buzzer connected.");
+
+  // Check whether the read was successful
+  if (buzzer.readConfig(config) != 0) {
+    Serial.println("Could not read the configuration. Freezing.");
+    while (1);
+  }
+  printConfig();
+
+  // Only the volume register is written
+  config.volume = SFE_QWIIC_BUZZER_VOLUME_MIN;
+  buzzer.writeConfig(config);
+
+  Serial.println("Volume changed, reading again...");
+  buzzer.readConfig(config);
+  printConfig();
+}
+
+void loop() {
+// do nothing here
+}
@@ -0,0 +1,66 @@
+/******************************************************************************
+  Example_19_Scan
+
+  This example finds every Qwiic Buzzer on the I2C bus, whatever its address,
+  and begins one QwiicBuzzer per buzzer found. Each address is probed with a
+  single transaction. Addresses used by other devices on the bus can be added
+  to the exclusion set so they are never probed.
+
+  Each buzzer found beeps in turn, so you can tell which is which.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to one or more Qwiic Buzzers, with
+  different I2C addresses
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+
+#define MAX_BUZZERS 8
+
+QwiicBuzzer buzzers[MAX_BUZZERS];
+uint8_t buzzerCount = 0;
+
+// Addresses of other devices on the bus, that should not be probed
+sfDevBuzzerAddressSet otherDevices;
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_19_Scan");
+  Wire.begin(); //Join I2C bus
+
+  // Uncomment and edit to skip the addresses of your other devices
+  // otherDevices.add(0x48);
+
+  unsigned long start = micros();
+  buzzerCount = QwiicBuzzer::beginAll(buzzers, MAX_BUZZERS, Wire, &otherDevices);
+  unsigned long elapsed = micros() - start;
+
+  Serial.print("Found ");
+  Serial.print(buzzerCount);
+  Serial.print(" buzzer(s) in ");
+  Serial.print(elapsed);
+  Serial.println("us");
+
+  for (uint8_t i = 0; i < buzzerCount; i++) {
+    Serial.print("Buzzer ");
+    Serial.print(i);
+    Serial.print(" at address 0x");
+    Serial.println(buzzers[i].address(), HEX);
+  }
+}
+
+void loop() {
+  for (uint8_t i = 0; i < buzzerCount; i++) {
+    buzzers[i].play(SFE_QWIIC_BUZZER_NOTE_C5 + 200 * i, 100, SFE_QWIIC_BUZZER_VOLUME_MID);
+    delay(500);
+  }
+  delay(1000);
+}
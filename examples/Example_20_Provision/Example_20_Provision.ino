@@ -0,0 +1,81 @@
+/******************************************************************************
+  Example_20_Provision
+
+  This example gives I2C addresses to many buzzers, without changing them one
+  by one with Example_05. Start the sketch, then attach the buzzers to the bus
+  one at a time: each new buzzer (at the default address, 0x34) is moved to
+  the next address of the list, verified, and the address is saved. The
+  buzzer beeps once it is done, so you can attach the next one.
+
+  Addresses of the list already used by another device on the bus are
+  skipped.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to the bus, then attach Qwiic Buzzers one
+  at a time
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+QwiicBuzzerProvisioner provisioner;
+
+// Addresses to give the buzzers, in order
+const uint8_t targets[] = {0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47};
+const uint8_t targetCount = sizeof(targets) / sizeof(targets[0]);
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_20_Provision");
+  Wire.begin(); //Join I2C bus
+
+  if (provisioner.begin(targets, targetCount) == false) {
+    Serial.println("Invalid target address! Freezing.");
+    while (1);
+  }
+  Serial.println("Attach the first buzzer.");
+}
+
+void loop() {
+  switch (provisioner.update()) {
+  case kSfeQwiicBuzzerProvisionAssigned: {
+    Serial.print("Buzzer moved to address 0x");
+    Serial.print(provisioner.lastAddress(), HEX);
+    Serial.print(", ");
+    Serial.print(provisioner.remaining());
+    Serial.println(" address(es) left. Attach the next buzzer.");
+
+    // Beep at the new address, so you know it's done
+    QwiicBuzzer buzzer;
+    if (buzzer.begin(provisioner.lastAddress()) == true)
+      buzzer.play(SFE_QWIIC_BUZZER_NOTE_C6, 100, SFE_QWIIC_BUZZER_VOLUME_MID);
+    break;
+  }
+
+  case kSfeQwiicBuzzerProvisionFailed:
+    Serial.println("Verification failed, the buzzer is back at 0x34. Detach it and attach it again.");
+    break;
+
+  case kSfeQwiicBuzzerProvisionDone:
+    Serial.println("All addresses are assigned.");
+    for (uint8_t i = 0; i < targetCount; i++) {
+      if (provisioner.collisions().contains(targets[i])) {
+        Serial.print("Skipped 0x");
+        Serial.print(targets[i], HEX);
+        Serial.println(", another device is there.");
+      }
+    }
+    while (1);
+
+  default:
+    break;
+  }
+
+  delay(250);
+}
@@ -0,0 +1,92 @@
+/******************************************************************************
+  Example_21_Bus_Errors
+
+  This example shows how the library copes with a noisy I2C bus, such as a
+  long Qwiic cable. Failed register reads and writes are retried with a
+  backoff, the buzzer is begun again after repeated failures, and a sound
+  effect that can't go on is aborted with the buzzer turned off.
+
+  No buzzer is needed: the sound effects are played on an emulated Qwiic
+  Buzzer (sfDevBuzzerMockBus) that NAKs one transaction out of 7. They are
+  played once without retries, and once with the default retry policy, and
+  the bus error counters of each run are printed.
+
+  The buzzer waits on the simulated time of the emulated buzzer
+  (sfDevBuzzerMockClock), so the effects take no real time at all, and
+  their steps still turn themselves off when they should.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  None, the buzzer is emulated.
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+#include <sfTk/sfDevBuzzerMockBus.h>
+
+sfDevBuzzerMockBus mockBus;
+sfDevBuzzerMockClock mockClock(mockBus);
+sfDevBuzzer buzzer;
+
+#define BUZZER_VOLUME 3
+
+void run(const char *name, const sfDevBuzzerRetryPolicy &policy) {
+  buzzer.setRetryPolicy(policy);
+  buzzer.resetBusStats();
+
+  uint8_t played = 0;
+  for (uint8_t i = 0; i < SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT; i++) {
+    if (buzzer.playSoundEffect(i, BUZZER_VOLUME) == true)
+      played++;
+  }
+
+  sfDevBuzzerBusStats stats;
+  buzzer.busStats(stats);
+
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(played);
+  Serial.print(" of ");
+  Serial.print(SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT);
+  Serial.print(" effects played, errors=");
+  Serial.print(stats.errors);
+  Serial.print(" retries=");
+  Serial.print(stats.retries);
+  Serial.print(" failures=");
+  Serial.print(stats.failures);
+  Serial.print(" rebegins=");
+  Serial.print(stats.rebegins);
+  Serial.print(" aborts=");
+  Serial.println(stats.aborts);
+}
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_21_Bus_Errors");
+
+  buzzer.setTimingClock(&mockClock);
+  if (buzzer.begin(&mockBus) != 0) {
+    Serial.println("Emulated buzzer did not connect! Freezing.");
+    while (1);
+  }
+
+  // One transaction out of 7 fails from now on
+  mockBus.injectFaults(0, 7);
+
+  const sfDevBuzzerRetryPolicy noRetries = {0, 0, 0, 0};
+  run("No retries", noRetries);
+
+  const sfDevBuzzerRetryPolicy defaultPolicy = {SFE_QWIIC_BUZZER_RETRY_COUNT, SFE_QWIIC_BUZZER_RETRY_BACKOFF,
+                                                SFE_QWIIC_BUZZER_RETRY_BACKOFF_MAX, SFE_QWIIC_BUZZER_REBEGIN_AFTER};
+  run("Default retries", defaultPolicy);
+}
+
+void loop() {
+// do nothing here
+}
@@ -0,0 +1,70 @@
+/******************************************************************************
+  Example_22_Glide
+
+  This example glides from A4 to A5 and back along each of the glide curves:
+    linear      - the same number of Hz per step, rushes through the top
+    exponential - the same ratio per step, sounds even to the ear
+    musical     - semitone by semitone, like a glissando
+
+  It then plays a "swoop" sound effect made of two glides, without blocking.
+
+  The number of steps of each glide comes from the write budget of the
+  buzzer: try a lower budget with setWriteBudget() to hear the steps.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzer
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+QwiicBuzzer buzzer;
+
+#define BUZZER_VOLUME 3
+
+// Up and down again, 300ms each way
+const sfDevBuzzerSegment swoop[] SFE_QWIIC_BUZZER_PROGMEM = {
+  SFE_QWIIC_BUZZER_GLIDE(400, 3000, 300, kSfeQwiicBuzzerGlideExponential),
+  SFE_QWIIC_BUZZER_GLIDE(3000, 400, 300, kSfeQwiicBuzzerGlideExponential)};
+const sfDevBuzzerEffect swoopEffect SFE_QWIIC_BUZZER_PROGMEM = SFE_QWIIC_BUZZER_EFFECT(swoop, 2);
+
+void glideUpAndDown(const char *name, sfDevBuzzerGlideCurve curve) {
+  Serial.println(name);
+  buzzer.glide(SFE_QWIIC_BUZZER_NOTE_A4, SFE_QWIIC_BUZZER_NOTE_A5, 1000, curve, BUZZER_VOLUME);
+  buzzer.glide(SFE_QWIIC_BUZZER_NOTE_A5, SFE_QWIIC_BUZZER_NOTE_A4, 1000, curve, BUZZER_VOLUME);
+  delay(500);
+}
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_22_Glide");
+  Wire.begin(); //Join I2C bus
+
+  //check if buzzer will connect over I2C
+  if (buzzer.begin() == false) {
+    Serial.println("Device did not connect! Freezing.");
+    while (1);
+  }
+  Serial.println("Buzzer connected.");
+}
+
+void loop() {
+  glideUpAndDown("Linear", kSfeQwiicBuzzerGlideLinear);
+  glideUpAndDown("Exponential", kSfeQwiicBuzzerGlideExponential);
+  glideUpAndDown("Musical", kSfeQwiicBuzzerGlideMusical);
+
+  Serial.println("Swoop");
+  buzzer.startSoundEffect(swoopEffect, BUZZER_VOLUME);
+  while (buzzer.isPlaying()) {
+    buzzer.update(millis());
+    // the rest of your sketch keeps running here
+  }
+
+  delay(2000);
+}
@@ -0,0 +1,94 @@
+/******************************************************************************
+  Example_23_Timing
+
+  This example plays each sound effect without blocking, while the rest of
+  loop() takes a varying amount of time, and prints how well the steps of the
+  effect kept to their schedule.
+
+  Each step is due a fixed time after the previous one was due. When loop()
+  is held up, a step is played late, and the next ones are played sooner to
+  catch up, so the effect still ends on time. Only a step held up more than
+  SFE_QWIIC_BUZZER_RESYNC_MS restarts the schedule.
+
+  Try a slower busyWork() to see the lateness and jitter grow.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzer
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+QwiicBuzzer buzzer;
+
+#define BUZZER_VOLUME 3 // pretty good volume for most things
+
+uint8_t soundEffect = 0;
+
+// Stands in for the rest of a sketch, taking 0 to 3ms
+void busyWork() {
+  delay(random(0, 4));
+}
+
+void printStats() {
+  sfDevBuzzerTimingStats stats;
+  buzzer.timingStats(stats);
+
+  Serial.print("  steps: ");
+  Serial.print(stats.steps);
+  Serial.print(", late: ");
+  Serial.print(stats.lateSteps);
+  Serial.print(", mean lateness: ");
+  Serial.print(stats.steps > 0 ? (float)stats.totalLateMs / stats.steps : 0.0);
+  Serial.print("ms, worst: ");
+  Serial.print(stats.maxLateMs);
+  Serial.print("ms, jitter: ");
+  Serial.print(stats.jitterMs);
+  Serial.print("ms, resyncs: ");
+  Serial.println(stats.resyncs);
+}
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_23_Timing");
+  Wire.begin(); //Join I2C bus
+  Wire.setClock(400000); // sound effects require changing configuration quickly
+
+  //check if buzzer will connect over I2C
+  if (buzzer.begin() == false) {
+    Serial.println("Device did not connect! Freezing.");
+    while (1);
+  }
+  Serial.println("Buzzer connected.");
+
+  // Give each step of the effects its duration, so a late step never leaves
+  // the buzzer on
+  buzzer.setEffectTiming(kSfeQwiicBuzzerTimingDevice);
+}
+
+void loop() {
+  Serial.print("Sound Effect: ");
+  Serial.println(soundEffect);
+
+  buzzer.resetTimingStats();
+  unsigned long start = millis();
+  buzzer.startSoundEffect(soundEffect, BUZZER_VOLUME);
+  while (buzzer.isPlaying()) {
+    buzzer.update(millis());
+    busyWork();
+  }
+
+  Serial.print("  length: ");
+  Serial.print(millis() - start);
+  Serial.println("ms");
+  printStats();
+
+  soundEffect = (soundEffect + 1) % 10;
+  delay(2000);
+}
@@ -0,0 +1,76 @@
+/******************************************************************************
+  Example_24_Static_Buzzers
+
+  This example plays a fast arpeggio on two buzzers, with QwiicBuzzerT.
+
+  QwiicBuzzerT only plays tones, but its bus calls are bound when the sketch
+  is compiled, and each buzzer takes 16 bytes of RAM. Here, the address of
+  each buzzer is a template parameter too, so both share a single bus object:
+  each buzzer points the bus at itself before talking to it.
+
+  Note, this example requires two buzzers, at addresses 0x34 and 0x35. Use
+  Example_05_ChangeI2CAddress to change the address of one of them first.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzer
+  Connect another QWIIC cable from the first buzzer to the second buzzer
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+
+sfTkArdI2C bus;
+QwiicBuzzerT<0x34> buzzer1;
+QwiicBuzzerT<0x35> buzzer2;
+
+#define BUZZER_VOLUME 3
+
+// Notes played by each buzzer, ready to be written
+sfDevBuzzerNote notes1[4];
+sfDevBuzzerNote notes2[4];
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_24_Static_Buzzers");
+  Wire.begin(); //Join I2C bus
+  Wire.setClock(400000);
+
+  bus.init(Wire, 0x34);
+
+  //check if buzzers will connect over I2C
+  if (buzzer1.begin(&bus) != 0 || buzzer2.begin(&bus) != 0) {
+    Serial.println("Devices did not connect! Freezing.");
+    while (1);
+  }
+  Serial.println("Buzzers connected.");
+
+  const uint16_t low[4] = {SFE_QWIIC_BUZZER_NOTE_C4, SFE_QWIIC_BUZZER_NOTE_E4, SFE_QWIIC_BUZZER_NOTE_G4,
+                           SFE_QWIIC_BUZZER_NOTE_E4};
+  const uint16_t high[4] = {SFE_QWIIC_BUZZER_NOTE_C5, SFE_QWIIC_BUZZER_NOTE_G5, SFE_QWIIC_BUZZER_NOTE_E5,
+                            SFE_QWIIC_BUZZER_NOTE_G5};
+  for (uint8_t i = 0; i < 4; i++) {
+    sfDevBuzzer::makeNote(notes1[i], low[i], 0, BUZZER_VOLUME);
+    sfDevBuzzer::makeNote(notes2[i], high[i], 0, BUZZER_VOLUME);
+  }
+}
+
+void loop() {
+  for (uint8_t repeat = 0; repeat < 8; repeat++) {
+    for (uint8_t i = 0; i < 4; i++) {
+      buzzer1.play(notes1[i]);
+      buzzer2.play(notes2[i]);
+      delay(60);
+    }
+  }
+
+  buzzer1.off();
+  buzzer2.off();
+  delay(2000);
+}
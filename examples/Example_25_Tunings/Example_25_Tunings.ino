@@ -0,0 +1,97 @@
+/******************************************************************************
+  Example_25_Tunings
+
+  This example plays the melody of Example_14_Melody_Packed four times: as it
+  is, an octave up, a fifth down, and with A4 tuned to 432Hz instead of 440Hz.
+
+  The melody player looks each note up in a pitch table, indexed by MIDI note
+  number (60 = middle C). The tables are worked out when the sketch is
+  compiled, one per tuning used, and hold the notes as the bytes written to
+  the buzzer. Transposing a melody is adding a number of semitones to each
+  note, so none of this costs any time while the melody plays.
+
+  By Pete Lewis @ SparkFun Electronics
+  February 2024
+
+  SparkFun code, firmware, and software is released under the MIT License.
+	Please see LICENSE.md for further details.
+
+  Hardware Connections:
+  Connect QWIIC cable from Arduino to Qwiic Buzzer
+
+  Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <SparkFun_Qwiic_Buzzer_Arduino_Library.h>
+QwiicBuzzer buzzer;
+
+// notes in the melody, and their durations
+const uint8_t melody[] SFE_QWIIC_BUZZER_PROGMEM = {
+  sfDevBuzzerNoteIndex(kSfeQwiicBuzzerC, 4), SFE_QWIIC_BUZZER_MELODY_QUARTER,
+  sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 3), SFE_QWIIC_BUZZER_MELODY_EIGHTH,
+  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 3),
+  sfDevBuzzerNoteIndex(kSfeQwiicBuzzerA, 3), SFE_QWIIC_BUZZER_MELODY_QUARTER,
+  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 3),
+  SFE_QWIIC_BUZZER_MELODY_SAME | SFE_QWIIC_BUZZER_MELODY_REST,  // silence (aka "rest")
+  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerB, 3),
+  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerC, 4),
+  SFE_QWIIC_BUZZER_MELODY_END
+};
+
+sfDevBuzzerMelodyArray melodySource(melody, sizeof(melody));
+sfDevBuzzerMelodyPlayer player;
+
+// The frequencies can also be worked out at compile time
+static_assert(sfDevBuzzerMidiFrequency(60) == SFE_QWIIC_BUZZER_NOTE_C4, "middle C is 262Hz");
+
+// Transposition and tuning of each turn: nullptr is the standard tuning
+const int8_t transpose[] = {0, 12, -7, 0};
+const sfDevBuzzerPitch *tunings[] = {nullptr, nullptr, nullptr, sfDevBuzzerTuning<432>::pitches};
+const char *names[] = {"As written", "An octave up", "A fifth down", "A4 = 432Hz"};
+uint8_t turn = 0;
+
+void startTurn() {
+  Serial.println(names[turn]);
+  melodySource.rewind();
+  player.setTranspose(transpose[turn]);
+  player.setTuning(tunings[turn]);
+  player.start(&buzzer, &melodySource, SFE_QWIIC_BUZZER_VOLUME_MAX);
+}
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Qwiic Buzzer Example_25_Tunings");
+  Wire.begin(); //Join I2C bus
+
+  //check if buzzer will connect over I2C
+  if (buzzer.begin() == false) {
+    Serial.println("Device did not connect! Freezing.");
+    while (1);
+  }
+  Serial.println("Buzzer connected.");
+
+  // A single note, straight from the standard table
+  Serial.print("A4 is ");
+  Serial.print(sfDevBuzzerMidiFrequency(69));
+  Serial.println("Hz");
+  sfDevBuzzerNote note;
+  buzzer.makeNote(note, sfDevBuzzerReadPitch(sfDevBuzzerStandardTuning::pitches, 69), 500, SFE_QWIIC_BUZZER_VOLUME_MAX);
+  buzzer.play(note);
+  delay(1000);
+
+  startTurn();
+}
+
+void loop() {
+  // Play the next note, if it is due
+  player.update(millis());
+
+  // Start the next turn, 1 second after the melody ends
+  static unsigned long nextTime = 0;
+  if (player.isPlaying() == true) {
+    nextTime = millis() + 1000;
+  } else if (millis() >= nextTime) {
+    turn = (turn + 1) % 4;
+    startTurn();
+  }
+}
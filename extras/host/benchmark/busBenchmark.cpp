@@ -0,0 +1,146 @@
+/**
+ * @file    busBenchmark.cpp
+ * @brief   Host version of Example_12_Bus_Benchmark
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details Measures the I2C bus cost of the sound effects and of a few
+ *          reference melodies on an emulated Qwiic Buzzer, at 100KHz, 400KHz
+ *          and 1MHz, and writes the results as CSV, one line per run:
+ *            name         - sound effect number, or melody name
+ *            clock_hz     - simulated I2C clock
+ *            transactions - number of I2C transactions
+ *            bytes        - bytes on the wire (addresses, register pointers and data)
+ *            bus_us       - time the bus was busy, in microseconds
+ *            play_ms      - length of the sound, in milliseconds
+ *
+ *          The runs are the same as the ones of Example_12_Bus_Benchmark, so
+ *          the results of a board and of a host can be compared. The CSV is
+ *          written to the file given on the command line, or to the standard
+ *          output.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzer.h"
+#include "sfDevBuzzerMockBus.h"
+#include "sfDevBuzzerPitches.h"
+
+#include <stdio.h>
+
+#define BUZZER_VOLUME 3
+
+static const uint32_t kClocks[] = {100000, 400000, 1000000};
+
+// The melody of Example_07_Melody
+static const uint16_t kMelodyExample07[] = {SFE_QWIIC_BUZZER_NOTE_C4, SFE_QWIIC_BUZZER_NOTE_G3,
+                                            SFE_QWIIC_BUZZER_NOTE_G3, SFE_QWIIC_BUZZER_NOTE_A3,
+                                            SFE_QWIIC_BUZZER_NOTE_G3, SFE_QWIIC_BUZZER_NOTE_REST,
+                                            SFE_QWIIC_BUZZER_NOTE_B3, SFE_QWIIC_BUZZER_NOTE_C4};
+static const uint8_t kDurationsExample07[] = {4, 8, 8, 4, 4, 4, 4, 4};
+
+// A C major scale in sixteenth notes
+static const uint16_t kMelodyScale[] = {SFE_QWIIC_BUZZER_NOTE_C5, SFE_QWIIC_BUZZER_NOTE_D5, SFE_QWIIC_BUZZER_NOTE_E5,
+                                        SFE_QWIIC_BUZZER_NOTE_F5, SFE_QWIIC_BUZZER_NOTE_G5, SFE_QWIIC_BUZZER_NOTE_A5,
+                                        SFE_QWIIC_BUZZER_NOTE_B5, SFE_QWIIC_BUZZER_NOTE_C6};
+static const uint8_t kDurationsScale[] = {16, 16, 16, 16, 16, 16, 16, 16};
+
+// The same note over and over, as an alarm would
+static const uint16_t kMelodyAlarm[] = {SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6,
+                                        SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6,
+                                        SFE_QWIIC_BUZZER_NOTE_A6, SFE_QWIIC_BUZZER_NOTE_A6};
+static const uint8_t kDurationsAlarm[] = {8, 8, 8, 8, 8, 8, 8, 8};
+
+static sfDevBuzzerMockBus mockBus;
+static sfDevBuzzer buzzer;
+
+static void report(FILE *out, const char *name, const uint32_t playMs)
+{
+    fprintf(out, "%s,%u,%u,%u,%u,%u\n", name, (unsigned)mockBus.clock(), (unsigned)mockBus.transactions(),
+            (unsigned)mockBus.wireBytes(), (unsigned)mockBus.busTimeUs(), (unsigned)playMs);
+}
+
+// Plays a sound effect with the non-blocking player, moving the simulated
+// time forward one millisecond at a time
+static void benchmarkSoundEffect(FILE *out, const uint8_t effect)
+{
+    // Start from an unknown device state, as a fresh call would
+    buzzer.invalidateCache();
+    mockBus.resetStats();
+
+    uint32_t playMs = 0;
+    buzzer.startSoundEffect(effect, BUZZER_VOLUME);
+    while (buzzer.isPlaying())
+    {
+        buzzer.update(playMs);
+        if (buzzer.isPlaying())
+        {
+            mockBus.advanceTime(1);
+            playMs++;
+        }
+    }
+
+    char name[16];
+    snprintf(name, sizeof(name), "effect%u", effect);
+    report(out, name, playMs);
+}
+
+// Plays a melody the way Example_07_Melody does
+static void benchmarkMelody(FILE *out, const char *name, const uint16_t *melody, const uint8_t *durations,
+                            const uint8_t length)
+{
+    buzzer.invalidateCache();
+    mockBus.resetStats();
+
+    uint32_t playMs = 0;
+    for (uint8_t i = 0; i < length; i++)
+    {
+        uint16_t noteDuration = 1000 / durations[i];
+        buzzer.play(melody[i], noteDuration, SFE_QWIIC_BUZZER_VOLUME_MAX);
+
+        uint16_t pauseBetweenNotes = noteDuration * 13 / 10;
+        mockBus.advanceTime(pauseBetweenNotes);
+        playMs += pauseBetweenNotes;
+    }
+    report(out, name, playMs);
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *out = stdout;
+    if (argc > 1)
+    {
+        out = fopen(argv[1], "w");
+        if (out == nullptr)
+        {
+            fprintf(stderr, "Can't write %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    if (buzzer.begin(&mockBus) != ksfTkErrOk)
+    {
+        fprintf(stderr, "Emulated device did not connect!\n");
+        return 1;
+    }
+
+    fprintf(out, "name,clock_hz,transactions,bytes,bus_us,play_ms\n");
+    for (size_t c = 0; c < sizeof(kClocks) / sizeof(kClocks[0]); c++)
+    {
+        mockBus.setClock(kClocks[c]);
+
+        for (uint8_t effect = 0; effect < SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT; effect++)
+            benchmarkSoundEffect(out, effect);
+
+        benchmarkMelody(out, "melody_example07", kMelodyExample07, kDurationsExample07, sizeof(kDurationsExample07));
+        benchmarkMelody(out, "melody_scale", kMelodyScale, kDurationsScale, sizeof(kDurationsScale));
+        benchmarkMelody(out, "melody_alarm", kMelodyAlarm, kDurationsAlarm, sizeof(kDurationsAlarm));
+    }
+
+    if (out != stdout)
+        fclose(out);
+    return 0;
+}
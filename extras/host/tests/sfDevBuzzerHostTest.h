@@ -0,0 +1,100 @@
+/**
+ * @file    sfDevBuzzerHostTest.h
+ * @brief   Helpers shared by the host tests of the Qwiic Buzzer Library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares a minimal check macro, and sfDevBuzzerRecordingBus,
+ *          a mock bus that keeps every write together with the time it was
+ *          made and the state of the emulated buzzer after it. Unlike the log
+ *          of sfDevBuzzerMockBus, the record is not limited in size, so the
+ *          tests can check whole timelines.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzerMockBus.h"
+
+#include <stdio.h>
+#include <vector>
+
+// Number of failed checks, returned by main()
+extern int sfDevBuzzerTestFailures;
+
+/// @brief Checks a condition, and reports where it failed
+#define SFE_QWIIC_BUZZER_CHECK(condition)                                                                             \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(condition))                                                                                              \
+        {                                                                                                              \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                                      \
+            sfDevBuzzerTestFailures++;                                                                                 \
+        }                                                                                                              \
+    } while (0)
+
+/// @brief Checks that two integers are equal, and reports both if not
+#define SFE_QWIIC_BUZZER_CHECK_EQUAL(actual, expected)                                                                \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        long long actualValue = (long long)(actual);                                                                   \
+        long long expectedValue = (long long)(expected);                                                               \
+        if (actualValue != expectedValue)                                                                              \
+        {                                                                                                              \
+            printf("%s:%d: check failed: %s == %s (%lld != %lld)\n", __FILE__, __LINE__, #actual, #expected,           \
+                   actualValue, expectedValue);                                                                        \
+            sfDevBuzzerTestFailures++;                                                                                 \
+        }                                                                                                              \
+    } while (0)
+
+/// @brief One write on the recording bus
+struct sfDevBuzzerRecordedWrite
+{
+    uint32_t startUs;   ///< Simulated time at the start of the write
+    uint8_t devReg;     ///< First register written
+    uint8_t length;     ///< Number of bytes written
+    bool acked;         ///< False for a NAKed write
+    uint16_t frequency; ///< Tone frequency of the buzzer after the write
+    uint8_t volume;     ///< Volume of the buzzer after the write
+    uint16_t duration;  ///< Duration of the buzzer after the write
+    bool active;        ///< ACTIVE after the write
+};
+
+/// @brief A mock bus that records every write, see sfDevBuzzerRecordedWrite
+class sfDevBuzzerRecordingBus : public sfDevBuzzerMockBus
+{
+  public:
+    /// @brief Constructor
+    /// @param address I2C address of the emulated buzzer
+    /// @param clockHz Simulated I2C clock
+    sfDevBuzzerRecordingBus(const uint8_t address = 0x34, const uint32_t clockHz = 100000)
+        : sfDevBuzzerMockBus(address, clockHz)
+    {
+    }
+
+    using sfDevBuzzerMockBus::writeRegister;
+
+    sfTkError_t writeRegister(uint8_t *devReg, size_t regLength, const uint8_t *data, size_t length)
+    {
+        sfDevBuzzerRecordedWrite write;
+        write.startUs = nowUs();
+        write.devReg = devReg != nullptr ? *devReg : 0;
+        write.length = length;
+
+        sfTkError_t err = sfDevBuzzerMockBus::writeRegister(devReg, regLength, data, length);
+        write.acked = err == ksfTkErrOk;
+        write.frequency = (registerValue(kSfeQwiicBuzzerRegToneFrequencyMsb) << 8) |
+                          registerValue(kSfeQwiicBuzzerRegToneFrequencyLsb);
+        write.volume = registerValue(kSfeQwiicBuzzerRegVolume);
+        write.duration =
+            (registerValue(kSfeQwiicBuzzerRegDurationMsb) << 8) | registerValue(kSfeQwiicBuzzerRegDurationLsb);
+        write.active = registerValue(kSfeQwiicBuzzerRegActive) != 0;
+        writes.push_back(write);
+        return err;
+    }
+
+    std::vector<sfDevBuzzerRecordedWrite> writes;
+};
@@ -0,0 +1,98 @@
+/**
+ * @file    testAlerts.cpp
+ * @brief   Host test of the alert queue of the Qwiic Buzzer Library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details Plays alerts on the emulated buzzer, and checks that an alert
+ *          posted again while it is waiting or playing is merged with it
+ *          rather than played twice.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerHostTest.h"
+
+#include "sfDevBuzzerAlerts.h"
+
+int sfDevBuzzerTestFailures = 0;
+
+// Calls update() every millisecond until the queue is empty, and returns the
+// number of writes made
+static size_t playAll(sfDevBuzzerRecordingBus &bus, sfDevBuzzerAlerts &alerts, const sfDevBuzzerEffect *repost,
+                      const uint32_t repostMs)
+{
+    size_t first = bus.writes.size();
+    uint32_t startMs = bus.nowMs();
+    do
+    {
+        if (repost != nullptr && bus.nowMs() - startMs == repostMs)
+            SFE_QWIIC_BUZZER_CHECK(alerts.post(*repost, 9, SFE_QWIIC_BUZZER_VOLUME_MAX, kSfeQwiicBuzzerAlertResume));
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.update(bus.nowMs()), ksfTkErrOk);
+        bus.advanceTime(1);
+    } while ((alerts.isPlaying() || alerts.waiting() > 0) && bus.nowMs() - startMs < 60000);
+    return bus.writes.size() - first;
+}
+
+// An alert posted again while it plays carries on, and is not played twice
+static void checkMergePlaying()
+{
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+    sfDevBuzzerAlerts alerts;
+    alerts.begin(&buzzer);
+
+    const sfDevBuzzerEffect &effect = kSfeQwiicBuzzerSoundEffects[1];
+    SFE_QWIIC_BUZZER_CHECK(alerts.post(effect, 1, SFE_QWIIC_BUZZER_VOLUME_MAX));
+    size_t once = playAll(bus, alerts, nullptr, 0);
+    SFE_QWIIC_BUZZER_CHECK(once > 2);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.merges(), 0);
+
+    SFE_QWIIC_BUZZER_CHECK(alerts.post(effect, 1, SFE_QWIIC_BUZZER_VOLUME_MAX));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(playAll(bus, alerts, &effect, 20), once);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.merges(), 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.drops(), 0);
+}
+
+// An alert posted again while it waits is merged, and takes the higher
+// priority and the latest policy
+static void checkMergeWaiting()
+{
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+    sfDevBuzzerAlerts alerts;
+    alerts.begin(&buzzer);
+
+    const sfDevBuzzerEffect &low = kSfeQwiicBuzzerSoundEffects[1];
+    const sfDevBuzzerEffect &high = kSfeQwiicBuzzerSoundEffects[2];
+    SFE_QWIIC_BUZZER_CHECK(alerts.post(low, 1, SFE_QWIIC_BUZZER_VOLUME_MAX));
+    SFE_QWIIC_BUZZER_CHECK(alerts.post(low, 5, SFE_QWIIC_BUZZER_VOLUME_MAX, kSfeQwiicBuzzerAlertResume));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.waiting(), 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.merges(), 1);
+
+    // Priority 5 plays, and the new policy resumes it after a higher priority alert
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.update(bus.nowMs()), ksfTkErrOk);
+    bus.advanceTime(5);
+    SFE_QWIIC_BUZZER_CHECK(alerts.post(high, 3, SFE_QWIIC_BUZZER_VOLUME_MAX));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.update(bus.nowMs()), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.waiting(), 1);
+    SFE_QWIIC_BUZZER_CHECK(alerts.post(high, 7, SFE_QWIIC_BUZZER_VOLUME_MAX));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.update(bus.nowMs()), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.merges(), 2);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.waiting(), 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.drops(), 0);
+    playAll(bus, alerts, nullptr, 0);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(alerts.drops(), 0);
+}
+
+int main()
+{
+    checkMergePlaying();
+    checkMergeWaiting();
+    return sfDevBuzzerTestFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,269 @@
+/**
+ * @file    testEffects.cpp
+ * @brief   Host test of the sound effects of the Qwiic Buzzer Library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details Plays the built-in sound effects 0 to 9 on an emulated buzzer, with
+ *          host and device timing, and checks each write against a timeline
+ *          worked out from the effect descriptors: the number of transactions,
+ *          when each step is written, and the frequency and state it leaves the
+ *          buzzer in. Also plays glides, and a sweep starting at 0Hz, which
+ *          must end.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerHostTest.h"
+
+#include "sfDevBuzzer.h"
+
+int sfDevBuzzerTestFailures = 0;
+
+// One expected write: time from the start of the effect, and the frequency
+// played, 0 to turn the buzzer off
+struct expectedStep
+{
+    uint32_t atMs;
+    uint16_t frequency;
+    uint16_t duration;
+};
+
+// Works out the writes of an effect made of sweeps and rests
+static std::vector<expectedStep> expectedSteps(const sfDevBuzzerEffect &effect, const sfDevBuzzerEffectTiming timing)
+{
+    std::vector<expectedStep> steps;
+    uint32_t at = 0;
+    for (uint8_t pass = 0; pass < effect.repeat; pass++)
+    {
+        for (uint8_t index = 0; index < effect.segmentCount; index++)
+        {
+            const sfDevBuzzerSegment &segment = effect.segments[index];
+            if (segment.step == 0)
+            {
+                if (timing == kSfeQwiicBuzzerTimingHost)
+                    steps.push_back({at, 0, 0});
+                at += segment.dwell;
+                continue;
+            }
+
+            for (int32_t frequency = segment.startFrequency;
+                 segment.step > 0 ? frequency < segment.endFrequency : frequency > segment.endFrequency;
+                 frequency += segment.step)
+            {
+                // Device-timed steps overlap the next one, unless a rest or
+                // the end of the effect follows
+                int32_t following = frequency + segment.step;
+                bool last = segment.step > 0 ? following >= segment.endFrequency : following <= segment.endFrequency;
+                uint16_t duration = 0;
+                if (timing != kSfeQwiicBuzzerTimingHost)
+                {
+                    bool silenceNext = true;
+                    if (last)
+                    {
+                        uint8_t next = index + 1;
+                        if (next >= effect.segmentCount && pass + 1 < effect.repeat)
+                            next = 0;
+                        if (next < effect.segmentCount)
+                            silenceNext = effect.segments[next].step == 0;
+                    }
+                    duration = segment.dwell + (last && silenceNext ? 0 : SFE_QWIIC_BUZZER_EFFECT_SLACK);
+                }
+                steps.push_back({at, (uint16_t)frequency, duration});
+                at += segment.dwell;
+            }
+        }
+    }
+    if (timing == kSfeQwiicBuzzerTimingHost)
+        steps.push_back({at, 0, 0});
+    return steps;
+}
+
+static void checkEffect(const uint8_t number, const sfDevBuzzerEffectTiming timing)
+{
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzerMockClock clock(bus);
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+    buzzer.setTimingClock(&clock);
+    buzzer.setEffectTiming(timing);
+
+    bus.resetStats();
+    bus.writes.clear();
+    uint32_t startMs = bus.nowMs();
+    SFE_QWIIC_BUZZER_CHECK(buzzer.playSoundEffect(number, SFE_QWIIC_BUZZER_VOLUME_MAX));
+
+    std::vector<expectedStep> expected = expectedSteps(kSfeQwiicBuzzerSoundEffects[number], timing);
+
+    // One write per step, no reads
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.transactions(), expected.size());
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes.size(), expected.size());
+    if (bus.writes.size() != expected.size())
+    {
+        printf("effect %u, timing %u: %u writes, %u expected\n", number, timing, (unsigned)bus.writes.size(),
+               (unsigned)expected.size());
+        return;
+    }
+
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        const sfDevBuzzerRecordedWrite &write = bus.writes[i];
+        SFE_QWIIC_BUZZER_CHECK(write.acked);
+
+        // Each step is written in the millisecond it is due
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(write.startUs / 1000 - startMs, expected[i].atMs);
+
+        if (expected[i].frequency == 0)
+        {
+            SFE_QWIIC_BUZZER_CHECK(!write.active);
+            continue;
+        }
+        SFE_QWIIC_BUZZER_CHECK(write.active);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(write.frequency, expected[i].frequency);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(write.volume, SFE_QWIIC_BUZZER_VOLUME_MAX);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(write.duration, expected[i].duration);
+    }
+
+    // The buzzer is off at the end, on its own with device timing
+    bus.advanceTime(SFE_QWIIC_BUZZER_EFFECT_SLACK + 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 0);
+    SFE_QWIIC_BUZZER_CHECK(!buzzer.isPlaying());
+}
+
+// A sweep from 0Hz played forever while 0 meant "not started"
+static void checkSweepFromZero()
+{
+    static const sfDevBuzzerSegment kFromZero[] = {SFE_QWIIC_BUZZER_SWEEP(0, 300, 100, 10)};
+    static const sfDevBuzzerEffect kFromZeroEffect = SFE_QWIIC_BUZZER_EFFECT(kFromZero, 1);
+
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzerMockClock clock(bus);
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+    buzzer.setTimingClock(&clock);
+
+    bus.writes.clear();
+    buzzer.startSoundEffect(kFromZeroEffect, SFE_QWIIC_BUZZER_VOLUME_MAX);
+    for (int ms = 0; ms < 100 && buzzer.isPlaying(); ms++)
+    {
+        buzzer.update(bus.nowMs());
+        bus.advanceTime(1);
+    }
+    SFE_QWIIC_BUZZER_CHECK(!buzzer.isPlaying());
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes.size(), 4);
+    if (bus.writes.size() == 4)
+    {
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[0].frequency, 0);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[1].frequency, 100);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[2].frequency, 200);
+        SFE_QWIIC_BUZZER_CHECK(!bus.writes[3].active);
+    }
+}
+
+// A blocking glide: as many steps as the write budget allows, spread over its
+// length, from the first frequency to the last, then off
+static void checkGlide(const sfDevBuzzerGlideCurve curve)
+{
+    sfDevBuzzerRecordingBus bus(0x34, 400000);
+    sfDevBuzzerMockClock clock(bus);
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+    buzzer.setTimingClock(&clock);
+
+    const uint16_t fromHz = 200;
+    const uint16_t toHz = 2000;
+    const uint16_t durationMs = 500;
+    uint16_t steps = sfDevBuzzerGlideSteps(fromHz, toHz, durationMs, curve, SFE_QWIIC_BUZZER_WRITE_BUDGET);
+    if (curve != kSfeQwiicBuzzerGlideMusical)
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(steps, (uint32_t)durationMs * SFE_QWIIC_BUZZER_WRITE_BUDGET / 1000);
+
+    bus.resetStats();
+    bus.writes.clear();
+    uint32_t startMs = bus.nowMs();
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.glide(fromHz, toHz, durationMs, curve), ksfTkErrOk);
+
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.transactions(), steps + 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes.size(), steps + 1);
+    if (bus.writes.size() != (size_t)steps + 1)
+        return;
+
+    uint16_t previous = 0;
+    for (uint16_t step = 0; step < steps; step++)
+    {
+        const sfDevBuzzerRecordedWrite &write = bus.writes[step];
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(write.startUs / 1000 - startMs, (uint32_t)step * durationMs / steps);
+        SFE_QWIIC_BUZZER_CHECK(write.active);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(write.frequency,
+                                     sfDevBuzzerGlideFrequency(fromHz, toHz, step, steps, curve));
+        SFE_QWIIC_BUZZER_CHECK(write.frequency >= previous);
+        previous = write.frequency;
+    }
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[0].frequency, fromHz);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[steps - 1].frequency, toHz);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[steps].startUs / 1000 - startMs, durationMs);
+    SFE_QWIIC_BUZZER_CHECK(!bus.writes[steps].active);
+}
+
+// A glide within an effect, played by update() one step at a time
+static void checkGlideSegment()
+{
+    static const sfDevBuzzerSegment kGlide[] = {
+        SFE_QWIIC_BUZZER_GLIDE(1000, 500, 100, kSfeQwiicBuzzerGlideLinear), SFE_QWIIC_BUZZER_REST(50)};
+    static const sfDevBuzzerEffect kGlideEffect = SFE_QWIIC_BUZZER_EFFECT(kGlide, 2);
+
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+
+    uint16_t steps = sfDevBuzzerGlideSteps(1000, 500, 100, kSfeQwiicBuzzerGlideLinear, SFE_QWIIC_BUZZER_WRITE_BUDGET);
+    bus.writes.clear();
+    uint32_t startMs = bus.nowMs();
+    buzzer.startSoundEffect(kGlideEffect, SFE_QWIIC_BUZZER_VOLUME_MAX);
+    for (int ms = 0; ms < 1000 && buzzer.isPlaying(); ms++)
+    {
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.update(bus.nowMs()), ksfTkErrOk);
+        bus.advanceTime(1);
+    }
+    SFE_QWIIC_BUZZER_CHECK(!buzzer.isPlaying());
+
+    // Twice: the steps of the glide, and the rest. The buzzer is already off
+    // at the end of the effect, so that takes no write.
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes.size(), 2 * (steps + 1));
+    if (bus.writes.size() != 2 * ((size_t)steps + 1))
+        return;
+
+    for (uint8_t pass = 0; pass < 2; pass++)
+    {
+        const sfDevBuzzerRecordedWrite *writes = &bus.writes[pass * (steps + 1)];
+        uint32_t passMs = pass * 150;
+        for (uint16_t step = 0; step < steps; step++)
+        {
+            SFE_QWIIC_BUZZER_CHECK_EQUAL(writes[step].startUs / 1000 - startMs, passMs + (uint32_t)step * 100 / steps);
+            SFE_QWIIC_BUZZER_CHECK_EQUAL(writes[step].frequency,
+                                         sfDevBuzzerGlideFrequency(1000, 500, step, steps, kSfeQwiicBuzzerGlideLinear));
+        }
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(writes[0].frequency, 1000);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(writes[steps - 1].frequency, 500);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(writes[steps].startUs / 1000 - startMs, passMs + 100);
+        SFE_QWIIC_BUZZER_CHECK(!writes[steps].active);
+    }
+}
+
+int main()
+{
+    for (uint8_t number = 0; number < SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT; number++)
+    {
+        checkEffect(number, kSfeQwiicBuzzerTimingHost);
+        checkEffect(number, kSfeQwiicBuzzerTimingDevice);
+    }
+    checkSweepFromZero();
+    checkGlide(kSfeQwiicBuzzerGlideLinear);
+    checkGlide(kSfeQwiicBuzzerGlideExponential);
+    checkGlide(kSfeQwiicBuzzerGlideMusical);
+    checkGlideSegment();
+
+    return sfDevBuzzerTestFailures == 0 ? 0 : 1;
+}
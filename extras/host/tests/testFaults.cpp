@@ -0,0 +1,179 @@
+/**
+ * @file    testFaults.cpp
+ * @brief   Host test of the bus error handling of the Qwiic Buzzer Library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details Makes the emulated buzzer NAK transactions, and checks that retries
+ *          hide occasional faults, that an effect which fails anyway is
+ *          aborted with the buzzer off, and that repeated failures make the
+ *          driver begin() again, without losing a queued save.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerHostTest.h"
+
+#include "sfDevBuzzer.h"
+
+int sfDevBuzzerTestFailures = 0;
+
+// One transaction out of seven NAKed: the retries hide every fault
+static void checkRetries()
+{
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzerMockClock clock(bus);
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+    buzzer.setTimingClock(&clock);
+
+    bus.injectFaults(0, 7);
+    for (uint8_t number = 0; number < SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT; number++)
+    {
+        SFE_QWIIC_BUZZER_CHECK(buzzer.playSoundEffect(number, SFE_QWIIC_BUZZER_VOLUME_MAX));
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 0);
+    }
+
+    sfDevBuzzerBusStats stats;
+    buzzer.busStats(stats);
+    SFE_QWIIC_BUZZER_CHECK(stats.errors > 0);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.retries, stats.errors);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.failures, 0);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.aborts, 0);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.rebegins, 0);
+
+    // Each retry is one more write of the same registers
+    uint32_t naked = 0;
+    for (size_t i = 0; i < bus.writes.size(); i++)
+    {
+        if (bus.writes[i].acked)
+            continue;
+        naked++;
+        SFE_QWIIC_BUZZER_CHECK(i + 1 < bus.writes.size() && bus.writes[i + 1].devReg == bus.writes[i].devReg);
+    }
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(naked, stats.errors);
+}
+
+// Without retries, a NAKed step aborts the effect, and the buzzer is turned off
+static void checkAbort()
+{
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzerMockClock clock(bus);
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+    buzzer.setTimingClock(&clock);
+    sfDevBuzzerRetryPolicy policy = {0, 0, 0, 0};
+    buzzer.setRetryPolicy(policy);
+
+    // The sixth step is NAKed, the off() after it is not
+    bus.writes.clear();
+    bus.injectFaults(0, 6);
+    SFE_QWIIC_BUZZER_CHECK(!buzzer.playSoundEffect(0, SFE_QWIIC_BUZZER_VOLUME_MAX));
+    bus.injectFaults(0, 0);
+    SFE_QWIIC_BUZZER_CHECK(!buzzer.isPlaying());
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 0);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes.size(), 7);
+    if (bus.writes.size() == 7)
+    {
+        SFE_QWIIC_BUZZER_CHECK(!bus.writes[5].acked);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[6].devReg, kSfeQwiicBuzzerRegActive);
+        SFE_QWIIC_BUZZER_CHECK(bus.writes[6].acked);
+    }
+
+    sfDevBuzzerBusStats stats;
+    buzzer.busStats(stats);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.errors, 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.retries, 0);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.failures, 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.aborts, 1);
+
+    // The same with update()
+    bus.injectFaults(0, 6);
+    SFE_QWIIC_BUZZER_CHECK(buzzer.startSoundEffect(2, SFE_QWIIC_BUZZER_VOLUME_MAX));
+    sfTkError_t err = ksfTkErrOk;
+    for (int ms = 0; ms < 5000 && buzzer.isPlaying(); ms++)
+    {
+        sfTkError_t stepErr = buzzer.update(bus.nowMs());
+        if (err == ksfTkErrOk)
+            err = stepErr;
+        bus.advanceTime(1);
+    }
+    bus.injectFaults(0, 0);
+    SFE_QWIIC_BUZZER_CHECK(err != ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK(!buzzer.isPlaying());
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 0);
+    buzzer.busStats(stats);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.aborts, 2);
+}
+
+// Failures in a row make the driver begin() again, with a ping and an ID read
+static void checkRebegin()
+{
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzerMockClock clock(bus);
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+    buzzer.setTimingClock(&clock);
+    sfDevBuzzerRetryPolicy policy = {1, 1, 1, 2};
+    buzzer.setRetryPolicy(policy);
+
+    // Two failed calls of two attempts each, then the buzzer answers again
+    bus.injectFaults(4);
+    SFE_QWIIC_BUZZER_CHECK(buzzer.on() != ksfTkErrOk);
+    bus.resetStats();
+    SFE_QWIIC_BUZZER_CHECK(buzzer.on() != ksfTkErrOk);
+
+    sfDevBuzzerBusStats stats;
+    buzzer.busStats(stats);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.failures, 2);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.rebegins, 1);
+
+    // Two write attempts, then begin(): a ping and a read of the ID
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.transactions(), 4);
+    sfDevBuzzerMockTransaction transaction;
+    SFE_QWIIC_BUZZER_CHECK(bus.logEntry(2, transaction) && transaction.type == kSfeQwiicBuzzerMockPing);
+    SFE_QWIIC_BUZZER_CHECK(bus.logEntry(3, transaction) && transaction.type == kSfeQwiicBuzzerMockRead);
+
+    // The driver carries on once the bus is back
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.play(1000, 100, SFE_QWIIC_BUZZER_VOLUME_MAX), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 1);
+}
+
+// A save queued before the driver begins again is still committed by update()
+static void checkRebeginKeepsSave()
+{
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzerMockClock clock(bus);
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+    buzzer.setTimingClock(&clock);
+    sfDevBuzzerRetryPolicy policy = {0, 0, 0, 1};
+    buzzer.setRetryPolicy(policy);
+    buzzer.setSaveInterval(1000);
+
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.configureBuzzer(1000, 0, SFE_QWIIC_BUZZER_VOLUME_MAX), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.saveSettings(), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.saveCount(), 0);
+
+    bus.injectFaults(1);
+    SFE_QWIIC_BUZZER_CHECK(buzzer.on() != ksfTkErrOk);
+    sfDevBuzzerBusStats stats;
+    buzzer.busStats(stats);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.rebegins, 1);
+
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.update(bus.nowMs()), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.saveCount(), 1);
+}
+
+int main()
+{
+    checkRetries();
+    checkAbort();
+    checkRebegin();
+    checkRebeginKeepsSave();
+
+    return sfDevBuzzerTestFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file    testGroup.cpp
+ * @brief   Host test of buzzer groups of the Qwiic Buzzer Library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details Starts a group of emulated buzzers, one of which NAKs, and checks
+ *          that the others are started first, in a single burst, and that
+ *          the failing buzzer is started after them with its retries.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerHostTest.h"
+
+#include "sfDevBuzzerGroup.h"
+
+int sfDevBuzzerTestFailures = 0;
+
+// Buzzers written to, in order, across all the buses
+static std::vector<uint8_t> writeOrder;
+
+/// @brief A recording bus that also notes its turn in writeOrder
+class orderedBus : public sfDevBuzzerRecordingBus
+{
+  public:
+    orderedBus(const uint8_t address) : sfDevBuzzerRecordingBus(address)
+    {
+    }
+
+    using sfDevBuzzerRecordingBus::writeRegister;
+
+    sfTkError_t writeRegister(uint8_t *devReg, size_t regLength, const uint8_t *data, size_t length)
+    {
+        writeOrder.push_back(deviceAddress());
+        return sfDevBuzzerRecordingBus::writeRegister(devReg, regLength, data, length);
+    }
+};
+
+static void checkBurst()
+{
+    orderedBus busA(0x34);
+    orderedBus busB(0x35);
+    orderedBus busC(0x36);
+    sfDevBuzzerMockClock clockA(busA);
+    sfDevBuzzer buzzerA;
+    sfDevBuzzer buzzerB;
+    sfDevBuzzer buzzerC;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzerA.begin(&busA), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzerB.begin(&busB), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzerC.begin(&busC), ksfTkErrOk);
+    buzzerA.setTimingClock(&clockA);
+
+    sfDevBuzzerGroup group;
+    SFE_QWIIC_BUZZER_CHECK(group.add(&buzzerA));
+    SFE_QWIIC_BUZZER_CHECK(group.add(&buzzerB));
+    SFE_QWIIC_BUZZER_CHECK(group.add(&buzzerC));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(group.configureBuzzer(1000, 0, SFE_QWIIC_BUZZER_VOLUME_MAX), ksfTkErrOk);
+
+    // The first write to A is NAKed: B and C start before A is tried again
+    writeOrder.clear();
+    busA.writes.clear();
+    busA.injectFaults(1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(group.on(), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(writeOrder.size(), 4);
+    if (writeOrder.size() == 4)
+    {
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(writeOrder[0], 0x34);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(writeOrder[1], 0x35);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(writeOrder[2], 0x36);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(writeOrder[3], 0x34);
+    }
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(busA.writes.size(), 2);
+    if (busA.writes.size() == 2)
+    {
+        SFE_QWIIC_BUZZER_CHECK(!busA.writes[0].acked);
+        SFE_QWIIC_BUZZER_CHECK(busA.writes[1].acked);
+    }
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(busA.registerValue(kSfeQwiicBuzzerRegActive), 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(busB.registerValue(kSfeQwiicBuzzerRegActive), 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(busC.registerValue(kSfeQwiicBuzzerRegActive), 1);
+
+    // The NAK of the burst is an error, but not a failure
+    sfDevBuzzerBusStats stats;
+    buzzerA.busStats(stats);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.errors, 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.retries, 0);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.failures, 0);
+
+    // A buzzer that doesn't answer at all fails on(), after its retries
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(group.off(), ksfTkErrOk);
+    busA.writes.clear();
+    busA.injectFaults(1 + SFE_QWIIC_BUZZER_RETRY_COUNT + 1);
+    SFE_QWIIC_BUZZER_CHECK(group.on() != ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(busA.writes.size(), 1 + SFE_QWIIC_BUZZER_RETRY_COUNT + 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(busB.registerValue(kSfeQwiicBuzzerRegActive), 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(busC.registerValue(kSfeQwiicBuzzerRegActive), 1);
+    buzzerA.busStats(stats);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(stats.failures, 1);
+}
+
+int main()
+{
+    checkBurst();
+    return sfDevBuzzerTestFailures == 0 ? 0 : 1;
+}
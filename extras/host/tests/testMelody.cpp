@@ -0,0 +1,173 @@
+/**
+ * @file    testMelody.cpp
+ * @brief   Host test of the melody player of the Qwiic Buzzer Library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details Plays the melody of Example_14_Melody_Packed on an emulated buzzer,
+ *          as written, transposed and in another tuning, and checks each write:
+ *          one per note and none for rests, when it is made, and the frequency,
+ *          volume and duration it leaves the buzzer with. Also changes the
+ *          transposition and tuning while the melody plays, and checks that
+ *          they apply from the very next note, and that a note shorter than
+ *          a millisecond still turns itself off.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerHostTest.h"
+
+#include "sfDevBuzzer.h"
+#include "sfDevBuzzerMelody.h"
+#include "sfDevBuzzerTuning.h"
+
+int sfDevBuzzerTestFailures = 0;
+
+static const uint8_t kMelody[] = {
+    sfDevBuzzerNoteIndex(kSfeQwiicBuzzerC, 4), SFE_QWIIC_BUZZER_MELODY_QUARTER,
+    sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 3), SFE_QWIIC_BUZZER_MELODY_EIGHTH,
+    SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 3),
+    sfDevBuzzerNoteIndex(kSfeQwiicBuzzerA, 3), SFE_QWIIC_BUZZER_MELODY_QUARTER,
+    SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 3),
+    SFE_QWIIC_BUZZER_MELODY_SAME | SFE_QWIIC_BUZZER_MELODY_REST,
+    SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerB, 3),
+    SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerC, 4),
+    SFE_QWIIC_BUZZER_MELODY_END};
+
+// The notes of kMelody as MIDI note numbers (0 for the rest), and their
+// lengths in milliseconds with a 1 second whole note
+static const uint8_t kMidiNotes[] = {60, 55, 55, 57, 55, 0, 59, 60};
+static const uint16_t kSoundMs[] = {250, 125, 125, 250, 250, 250, 250, 250};
+
+static void checkMelody(const int8_t transpose, const uint16_t a4Hz, const sfDevBuzzerPitch *pitches)
+{
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+
+    sfDevBuzzerMelodyArray source(kMelody, sizeof(kMelody));
+    sfDevBuzzerMelodyPlayer player;
+    player.setTranspose(transpose);
+    player.setTuning(pitches);
+
+    bus.resetStats();
+    bus.writes.clear();
+    uint32_t startMs = bus.nowMs();
+    player.start(&buzzer, &source, SFE_QWIIC_BUZZER_VOLUME_MID);
+    for (int ms = 0; ms < 5000 && player.isPlaying(); ms++)
+    {
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(player.update(bus.nowMs()), ksfTkErrOk);
+        bus.advanceTime(1);
+    }
+    SFE_QWIIC_BUZZER_CHECK(!player.isPlaying());
+
+    // One write per note, rests and the end of the melody take none
+    const size_t noteCount = sizeof(kMidiNotes) / sizeof(kMidiNotes[0]);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.transactions(), noteCount - 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes.size(), noteCount - 1);
+    if (bus.writes.size() != noteCount - 1)
+        return;
+
+    // Each note is due 130% of the length of the previous one after it
+    uint32_t atMs = 0;
+    size_t write = 0;
+    for (size_t i = 0; i < noteCount; i++)
+    {
+        if (kMidiNotes[i] != 0)
+        {
+            const sfDevBuzzerRecordedWrite &recorded = bus.writes[write++];
+            SFE_QWIIC_BUZZER_CHECK_EQUAL(recorded.startUs / 1000 - startMs, atMs);
+            SFE_QWIIC_BUZZER_CHECK(recorded.active);
+            SFE_QWIIC_BUZZER_CHECK_EQUAL(recorded.frequency, sfDevBuzzerMidiFrequency(kMidiNotes[i] + transpose, a4Hz));
+            SFE_QWIIC_BUZZER_CHECK_EQUAL(recorded.volume, SFE_QWIIC_BUZZER_VOLUME_MID);
+            SFE_QWIIC_BUZZER_CHECK_EQUAL(recorded.duration, kSoundMs[i]);
+        }
+        atMs += kSoundMs[i] + kSoundMs[i] * 3 / 10;
+    }
+
+    // Each note turns itself off
+    bus.advanceTime(kSoundMs[noteCount - 1]);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 0);
+}
+
+// Changes made while a note plays apply to the next one, although it was
+// already decoded
+static void checkChangeWhilePlaying()
+{
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+
+    sfDevBuzzerMelodyArray source(kMelody, sizeof(kMelody));
+    sfDevBuzzerMelodyPlayer player;
+    bus.writes.clear();
+    player.start(&buzzer, &source, SFE_QWIIC_BUZZER_VOLUME_MID);
+    for (int ms = 0; ms < 5000 && player.isPlaying(); ms++)
+    {
+        // Up an octave during the first note, in another tuning during the second
+        if (bus.writes.size() == 1)
+            player.setTranspose(12);
+        else if (bus.writes.size() == 2)
+            player.setTuning(sfDevBuzzerTuning<432>::pitches);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(player.update(bus.nowMs()), ksfTkErrOk);
+        bus.advanceTime(1);
+    }
+
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes.size(), 7);
+    if (bus.writes.size() != 7)
+        return;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[0].frequency, sfDevBuzzerMidiFrequency(60));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[1].frequency, sfDevBuzzerMidiFrequency(55 + 12));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[2].frequency, sfDevBuzzerMidiFrequency(55 + 12, 432));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[6].frequency, sfDevBuzzerMidiFrequency(60 + 12, 432));
+}
+
+// A note shorter than a millisecond at the tempo still turns itself off
+static void checkShortestNote()
+{
+    static const uint8_t kShort[] = {sfDevBuzzerNoteIndex(kSfeQwiicBuzzerA, 4), 7, SFE_QWIIC_BUZZER_MELODY_END};
+
+    sfDevBuzzerRecordingBus bus;
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+
+    // A 1/128 note with a 100ms whole note
+    sfDevBuzzerMelodyArray source(kShort, sizeof(kShort));
+    sfDevBuzzerMelodyPlayer player;
+    bus.writes.clear();
+    player.start(&buzzer, &source, SFE_QWIIC_BUZZER_VOLUME_MID, 100);
+    for (int ms = 0; ms < 100 && player.isPlaying(); ms++)
+    {
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(player.update(bus.nowMs()), ksfTkErrOk);
+        bus.advanceTime(1);
+    }
+    SFE_QWIIC_BUZZER_CHECK(!player.isPlaying());
+
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes.size(), 1);
+    if (bus.writes.size() != 1)
+        return;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[0].frequency, 440);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writes[0].duration, 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 0);
+}
+
+int main()
+{
+    // The standard table is the one the melody macros use
+    for (uint8_t index = 1; index < SFE_QWIIC_BUZZER_MELODY_NOTE_COUNT; index++)
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(sfDevBuzzerNoteFrequency(index),
+                                     sfDevBuzzerMidiFrequency(sfDevBuzzerNoteMidi(index)));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(sfDevBuzzerNoteFrequency(sfDevBuzzerNoteIndex(kSfeQwiicBuzzerA, 4)), 440);
+
+    checkMelody(0, SFE_QWIIC_BUZZER_TUNING_A4, nullptr);
+    checkMelody(12, SFE_QWIIC_BUZZER_TUNING_A4, nullptr);
+    checkMelody(-7, SFE_QWIIC_BUZZER_TUNING_A4, nullptr);
+    checkMelody(0, 432, sfDevBuzzerTuning<432>::pitches);
+    checkChangeWhilePlaying();
+    checkShortestNote();
+
+    return sfDevBuzzerTestFailures == 0 ? 0 : 1;
+}
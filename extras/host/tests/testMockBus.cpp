@@ -0,0 +1,161 @@
+/**
+ * @file    testMockBus.cpp
+ * @brief   Host test of the emulated Qwiic Buzzer and its simulated clock
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details Checks the register map of sfDevBuzzerMockBus (durations, saving
+ *          settings, changing the address), its timing model, and that
+ *          sfDevBuzzerMockClock wraps around like millis() rather than after
+ *          2^32 microseconds. Also checks that beginWithoutProbe() resets the
+ *          driver without any I2C traffic.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerHostTest.h"
+
+#include "sfDevBuzzer.h"
+
+int sfDevBuzzerTestFailures = 0;
+
+static void checkRegisters()
+{
+    sfDevBuzzerMockBus bus;
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+
+    uint8_t id = 0;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.deviceId(id), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(id, SFE_QWIIC_BUZZER_DEVICE_ID);
+
+    // A buzz with a duration turns itself off
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.play(1000, 100, SFE_QWIIC_BUZZER_VOLUME_LOW), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegToneFrequencyMsb), 1000 >> 8);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegToneFrequencyLsb), 1000 & 0xFF);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegVolume), SFE_QWIIC_BUZZER_VOLUME_LOW);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 1);
+    bus.advanceTime(99);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 1);
+    bus.advanceTime(1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 0);
+
+    // Without a duration, it buzzes until turned off
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.play(2000, 0, SFE_QWIIC_BUZZER_VOLUME_MAX), ksfTkErrOk);
+    bus.advanceTime(60000);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.off(), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 0);
+
+    // Saved settings survive a power cycle, the others don't
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.saveSettings(), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.flushSettings(), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.saveCount(), 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.configureBuzzer(3000, 0, SFE_QWIIC_BUZZER_VOLUME_MIN), ksfTkErrOk);
+    bus.powerCycle();
+    SFE_QWIIC_BUZZER_CHECK_EQUAL((bus.registerValue(kSfeQwiicBuzzerRegToneFrequencyMsb) << 8) |
+                                     bus.registerValue(kSfeQwiicBuzzerRegToneFrequencyLsb),
+                                 2000);
+
+    // A new address takes effect at once; invalid ones are ignored
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.setAddress(0x40), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.deviceAddress(), 0x40);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.isConnected(), ksfTkErrOk);
+    bus.setAddress(0x40);
+    uint8_t invalid = 0x7F;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writeRegister(kSfeQwiicBuzzerRegI2cAddress, &invalid, 1), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.deviceAddress(), 0x40);
+    bus.setAddress(0x34);
+    SFE_QWIIC_BUZZER_CHECK(bus.ping() != ksfTkErrOk);
+}
+
+// beginWithoutProbe() sends nothing, and forgets the cached registers like begin()
+static void checkBeginWithoutProbe()
+{
+    sfDevBuzzerMockBus bus;
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.beginWithoutProbe(nullptr), ksfTkErrFail);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.beginWithoutProbe(&bus), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.transactions(), 0);
+
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.configureBuzzer(1000, 0, SFE_QWIIC_BUZZER_VOLUME_MAX), ksfTkErrOk);
+    bus.resetStats();
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.configureBuzzer(1000, 0, SFE_QWIIC_BUZZER_VOLUME_MAX), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.transactions(), 0);
+
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.beginWithoutProbe(&bus), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.configureBuzzer(1000, 0, SFE_QWIIC_BUZZER_VOLUME_MAX), ksfTkErrOk);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.transactions(), 1);
+}
+
+static void checkTiming()
+{
+    // A write of 5 bytes: START, address, pointer, data and STOP, 9 bits a byte
+    const uint32_t bits = 1 + 9 * (1 + 1 + 5) + 1;
+    const uint8_t data[5] = {0x03, 0xE8, 4, 0, 0};
+    const uint32_t clocks[] = {100000, 400000, 1000000};
+    for (size_t i = 0; i < sizeof(clocks) / sizeof(clocks[0]); i++)
+    {
+        sfDevBuzzerMockBus bus(0x34, clocks[i]);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.clock(), clocks[i]);
+        uint32_t startUs = bus.nowUs();
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.writeRegister(kSfeQwiicBuzzerRegToneFrequencyMsb, data, 5), ksfTkErrOk);
+        uint32_t expectedUs = (bits * 1000000 + clocks[i] / 2) / clocks[i];
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.nowUs() - startUs, expectedUs);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.busTimeUs(), expectedUs);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.transactions(), 1);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.bytesWritten(), 5);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.wireBytes(), 7);
+
+        sfDevBuzzerMockTransaction transaction;
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.logCount(), 1);
+        SFE_QWIIC_BUZZER_CHECK(bus.logEntry(0, transaction));
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(transaction.type, kSfeQwiicBuzzerMockWrite);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(transaction.devReg, kSfeQwiicBuzzerRegToneFrequencyMsb);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(transaction.length, 5);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(transaction.startUs, startUs);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(transaction.durationUs, expectedUs);
+    }
+}
+
+// The simulated clock runs for 49.7 days before it wraps, like millis()
+static void checkClockWrap()
+{
+    sfDevBuzzerMockBus bus;
+    sfDevBuzzerMockClock clock(bus);
+
+    // Past 2^32 microseconds (71.6 minutes), milliseconds keep counting
+    uint32_t before = clock.ticksMs();
+    clock.delayMs(72UL * 60 * 1000);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(clock.ticksMs() - before, 72UL * 60 * 1000);
+    before = clock.ticksMs();
+    clock.delayMs(1000);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(clock.ticksMs() - before, 1000);
+
+    // A buzz with a duration still ends on time after that
+    sfDevBuzzer buzzer;
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzer.begin(&bus), ksfTkErrOk);
+    buzzer.setTimingClock(&clock);
+    SFE_QWIIC_BUZZER_CHECK(buzzer.playSoundEffect(2, SFE_QWIIC_BUZZER_VOLUME_MAX));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(bus.registerValue(kSfeQwiicBuzzerRegActive), 0);
+
+    // Past 2^32 milliseconds, it wraps around
+    clock.delayMs(0xFFFFFFFF - clock.ticksMs());
+    before = clock.ticksMs();
+    clock.delayMs(10);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL((uint32_t)(clock.ticksMs() - before), 10);
+    SFE_QWIIC_BUZZER_CHECK(clock.ticksMs() < 10);
+}
+
+int main()
+{
+    checkRegisters();
+    checkBeginWithoutProbe();
+    checkTiming();
+    checkClockWrap();
+
+    return sfDevBuzzerTestFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file    testRtttl.cpp
+ * @brief   Host test of the RTTTL parsers of the Qwiic Buzzer Library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details Parses the same RTTTL texts with SFE_QWIIC_BUZZER_RTTTL() and with
+ *          sfDevBuzzerRtttlSource, and checks that both give the same notes,
+ *          durations and tempo, including for durations of 0 and missing
+ *          defaults. Notes outside of the note table are rejected at compile
+ *          time.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerHostTest.h"
+
+#include "sfDevBuzzerRtttl.h"
+
+int sfDevBuzzerTestFailures = 0;
+
+#define TEXT_EXAMPLE "Tune:d=4,o=5,b=100:8e6,8e6,8p,8e6,8p,8c6,8e6,8p,g6,p,g"
+#define TEXT_NO_DEFAULTS "Plain::c,d#,2e.,16f#7,32p"
+#define TEXT_ZERO_DEFAULT "Zero:d=0,o=4,b=0:c,0d,8e,0f.,g"
+#define TEXT_SPACES "Spaced: d = 8, o = 3, b = 160: c, 4d#, e., 1p, b7"
+#define TEXT_RANGE "Range:d=16,o=4:b0,c1,d#8,p"
+
+SFE_QWIIC_BUZZER_RTTTL(tuneExample, TEXT_EXAMPLE);
+SFE_QWIIC_BUZZER_RTTTL(tuneNoDefaults, TEXT_NO_DEFAULTS);
+SFE_QWIIC_BUZZER_RTTTL(tuneZeroDefault, TEXT_ZERO_DEFAULT);
+SFE_QWIIC_BUZZER_RTTTL(tuneSpaces, TEXT_SPACES);
+SFE_QWIIC_BUZZER_RTTTL(tuneRange, TEXT_RANGE);
+
+// A duration of 0 is the default duration, for "d=0" as for a note
+static_assert(sfDevBuzzerRtttlParser::defaultDuration(TEXT_ZERO_DEFAULT, sizeof(TEXT_ZERO_DEFAULT) - 1) ==
+                  SFE_QWIIC_BUZZER_RTTTL_DEFAULT_DURATION,
+              "d=0 is the default duration");
+static_assert(tuneZeroDefault::data[1] == SFE_QWIIC_BUZZER_MELODY_QUARTER, "c is a quarter");
+static_assert(tuneZeroDefault::data[3] == SFE_QWIIC_BUZZER_MELODY_QUARTER, "0d is a quarter");
+static_assert(tuneZeroDefault::data[7] == (SFE_QWIIC_BUZZER_MELODY_QUARTER | SFE_QWIIC_BUZZER_MELODY_DOTTED),
+              "0f. is a dotted quarter");
+
+// Notes beyond the table are rejected, the ones at its ends are not
+#define TEXT_ABOVE "Above:o=5:c,g8"
+#define TEXT_BELOW "Below:o=5:c,a0"
+#define TEXT_OCTAVE "Octave:o=12:c"
+static_assert(!sfDevBuzzerRtttlParser::notesInTable(TEXT_ABOVE, sizeof(TEXT_ABOVE) - 1, 0, 2), "g8 is above D#8");
+static_assert(!sfDevBuzzerRtttlParser::notesInTable(TEXT_BELOW, sizeof(TEXT_BELOW) - 1, 0, 2), "a0 is below B0");
+static_assert(!sfDevBuzzerRtttlParser::notesInTable(TEXT_OCTAVE, sizeof(TEXT_OCTAVE) - 1, 0, 1), "no octave 12");
+static_assert(sfDevBuzzerRtttlParser::notesInTable(TEXT_RANGE, sizeof(TEXT_RANGE) - 1, 0, 4), "B0 to D#8");
+
+// Reads a whole packed melody from a source
+static std::vector<sfDevBuzzerMelodyEvent> readEvents(sfDevBuzzerMelodySource &source, const uint16_t wholeNoteMs)
+{
+    std::vector<sfDevBuzzerMelodyEvent> events;
+    sfDevBuzzerMelodyReader reader;
+    reader.start(&source, wholeNoteMs);
+    sfDevBuzzerMelodyEvent event;
+    while (reader.read(event))
+        events.push_back(event);
+    return events;
+}
+
+static void checkSame(const char *text, const uint8_t *data, const size_t length, const uint16_t wholeNoteMs)
+{
+    sfDevBuzzerMelodyArray compiled(data, length);
+    sfDevBuzzerRtttlSource parsed(text);
+
+    std::vector<sfDevBuzzerMelodyEvent> expected = readEvents(compiled, wholeNoteMs);
+    std::vector<sfDevBuzzerMelodyEvent> actual = readEvents(parsed, SFE_QWIIC_BUZZER_MELODY_DEFAULT_WHOLE_NOTE);
+
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(parsed.wholeNoteMs(), wholeNoteMs);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size() && i < expected.size(); i++)
+    {
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(actual[i].noteIndex, expected[i].noteIndex);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(actual[i].soundMs, expected[i].soundMs);
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(actual[i].periodMs, expected[i].periodMs);
+    }
+}
+
+int main()
+{
+    checkSame(TEXT_EXAMPLE, tuneExample::data, sizeof(tuneExample::data), tuneExample::wholeNoteMs);
+    checkSame(TEXT_NO_DEFAULTS, tuneNoDefaults::data, sizeof(tuneNoDefaults::data), tuneNoDefaults::wholeNoteMs);
+    checkSame(TEXT_ZERO_DEFAULT, tuneZeroDefault::data, sizeof(tuneZeroDefault::data), tuneZeroDefault::wholeNoteMs);
+    checkSame(TEXT_SPACES, tuneSpaces::data, sizeof(tuneSpaces::data), tuneSpaces::wholeNoteMs);
+    checkSame(TEXT_RANGE, tuneRange::data, sizeof(tuneRange::data), tuneRange::wholeNoteMs);
+
+    // The ends of the note table
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(tuneRange::data[0], 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(tuneRange::data[2], 2);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(tuneRange::data[4], SFE_QWIIC_BUZZER_MELODY_NOTE_COUNT - 1);
+
+    // The source can't reject notes as they arrive, and clamps them
+    sfDevBuzzerRtttlSource above(TEXT_ABOVE);
+    std::vector<sfDevBuzzerMelodyEvent> events = readEvents(above, SFE_QWIIC_BUZZER_MELODY_DEFAULT_WHOLE_NOTE);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(events.size(), 2);
+    if (events.size() == 2)
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(events[1].noteIndex, SFE_QWIIC_BUZZER_MELODY_NOTE_COUNT - 1);
+
+    return sfDevBuzzerTestFailures == 0 ? 0 : 1;
+}
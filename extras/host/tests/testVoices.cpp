@@ -0,0 +1,141 @@
+/**
+ * @file    testVoices.cpp
+ * @brief   Host test of the voices and the multi-track player of the Qwiic Buzzer Library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details Plays a two-track sequence on three emulated buzzers, and checks,
+ *          one millisecond at a time, that the notes sounding are the ones of
+ *          the tracks. Also checks that a note repeated on a buzzer already set
+ *          to its frequency only writes ACTIVE, and that a note shared by two
+ *          tracks sounds until both have ended it.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerHostTest.h"
+
+#include "sfDevBuzzerVoices.h"
+
+#include <algorithm>
+
+int sfDevBuzzerTestFailures = 0;
+
+#define VOICE_COUNT 3
+
+// Melody: C5 E5 C5 G5 as quarters, staccato; the C5 of the third note
+// finds its buzzer already set
+static const uint8_t kMelody[] = {sfDevBuzzerNoteIndex(kSfeQwiicBuzzerC, 5),
+                                  SFE_QWIIC_BUZZER_MELODY_QUARTER,
+                                  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerE, 5),
+                                  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerC, 5),
+                                  SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 5),
+                                  SFE_QWIIC_BUZZER_MELODY_END};
+
+// Bass: C3 and G3 as legato halves, then a rest and C5, shared with the melody
+static const uint8_t kBass[] = {sfDevBuzzerNoteIndex(kSfeQwiicBuzzerC, 3),
+                                SFE_QWIIC_BUZZER_MELODY_HALF | SFE_QWIIC_BUZZER_MELODY_LEGATO,
+                                SFE_QWIIC_BUZZER_MELODY_SAME | sfDevBuzzerNoteIndex(kSfeQwiicBuzzerG, 3),
+                                SFE_QWIIC_BUZZER_MELODY_REST,
+                                SFE_QWIIC_BUZZER_MELODY_EIGHTH,
+                                sfDevBuzzerNoteIndex(kSfeQwiicBuzzerC, 5),
+                                SFE_QWIIC_BUZZER_MELODY_WHOLE,
+                                SFE_QWIIC_BUZZER_MELODY_END};
+
+// Appends the notes sounding at a time on a track to a list of frequencies
+static void soundingNotes(const uint8_t *track, const size_t length, const uint32_t atMs,
+                          std::vector<uint16_t> &frequencies)
+{
+    sfDevBuzzerMelodyArray source(track, length);
+    sfDevBuzzerMelodyReader reader;
+    reader.start(&source, SFE_QWIIC_BUZZER_MELODY_DEFAULT_WHOLE_NOTE);
+
+    uint32_t startMs = 0;
+    sfDevBuzzerMelodyEvent event;
+    while (reader.read(event))
+    {
+        if (event.noteIndex != SFE_QWIIC_BUZZER_MELODY_REST && atMs >= startMs && atMs < startMs + event.soundMs)
+            frequencies.push_back(sfDevBuzzerNoteFrequency(event.noteIndex));
+        startMs += event.periodMs;
+    }
+}
+
+static void checkTracks()
+{
+    sfDevBuzzerRecordingBus buses[VOICE_COUNT];
+    sfDevBuzzer buzzers[VOICE_COUNT];
+    sfDevBuzzerVoices voices;
+    for (uint8_t i = 0; i < VOICE_COUNT; i++)
+    {
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(buzzers[i].begin(&buses[i]), ksfTkErrOk);
+        SFE_QWIIC_BUZZER_CHECK(voices.add(&buzzers[i]));
+        buses[i].writes.clear();
+    }
+
+    sfDevBuzzerMelodyArray melody(kMelody, sizeof(kMelody));
+    sfDevBuzzerMelodyArray bass(kBass, sizeof(kBass));
+    sfDevBuzzerTrackPlayer player;
+    SFE_QWIIC_BUZZER_CHECK(player.addTrack(&melody));
+    SFE_QWIIC_BUZZER_CHECK(player.addTrack(&bass));
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(player.trackCount(), 2);
+    player.start(&voices, SFE_QWIIC_BUZZER_VOLUME_MID);
+
+    uint32_t nowMs = 0;
+    uint32_t mismatches = 0;
+    for (; nowMs < 5000 && player.isPlaying(); nowMs++)
+    {
+        SFE_QWIIC_BUZZER_CHECK_EQUAL(player.update(nowMs), ksfTkErrOk);
+
+        std::vector<uint16_t> expected;
+        soundingNotes(kMelody, sizeof(kMelody), nowMs, expected);
+        soundingNotes(kBass, sizeof(kBass), nowMs, expected);
+        std::sort(expected.begin(), expected.end());
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+        std::vector<uint16_t> sounding;
+        for (uint8_t i = 0; i < VOICE_COUNT; i++)
+        {
+            if (buses[i].registerValue(kSfeQwiicBuzzerRegActive))
+                sounding.push_back((buses[i].registerValue(kSfeQwiicBuzzerRegToneFrequencyMsb) << 8) |
+                                   buses[i].registerValue(kSfeQwiicBuzzerRegToneFrequencyLsb));
+        }
+        std::sort(sounding.begin(), sounding.end());
+
+        if (sounding != expected && mismatches++ == 0)
+            printf("%s:%d: wrong notes at %ums\n", __FILE__, __LINE__, (unsigned)nowMs);
+    }
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(mismatches, 0);
+    SFE_QWIIC_BUZZER_CHECK(!player.isPlaying());
+
+    // The bass ends last, at the end of the period of its C5
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(nowMs, 500 + 500 + 125 * 13 / 10 + 1000 * 13 / 10 + 1);
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(voices.steals(), 0);
+
+    // The second C5 of the melody finds a buzzer set to C5, and only writes ACTIVE
+    uint32_t activeOnly = 0;
+    uint32_t writes = 0;
+    for (uint8_t i = 0; i < VOICE_COUNT; i++)
+    {
+        writes += buses[i].writes.size();
+        for (size_t w = 0; w < buses[i].writes.size(); w++)
+        {
+            const sfDevBuzzerRecordedWrite &write = buses[i].writes[w];
+            if (write.active && write.devReg == kSfeQwiicBuzzerRegActive && write.length == 1)
+                activeOnly++;
+        }
+    }
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(activeOnly, 1);
+
+    // One write to start and one to end each note, the shared C5 once
+    SFE_QWIIC_BUZZER_CHECK_EQUAL(writes, 2 * (4 + 2 + 1));
+}
+
+int main()
+{
+    checkTracks();
+
+    return sfDevBuzzerTestFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file    sfArduinoMacros.h
+ * @brief   Host stand-in for the function-like macros of Arduino.h
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details On a board, the SparkFun Toolkit includes Arduino.h before the
+ *          library, and Arduino.h defines bit(), min(), max(), abs() and
+ *          round() as macros. Any name of the library followed by "(" that
+ *          matches one of them is then rewritten by the preprocessor, and
+ *          the board build breaks. The host build includes this file ahead of
+ *          every source file, so that such a name breaks it too.
+ *
+ *          Like Arduino.h, the standard headers come first, so their own
+ *          declarations of these names are not affected.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#define bit(b) (1UL << (b))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define abs(x) ((x) > 0 ? (x) : -(x))
+#define round(x) ((x) >= 0 ? (long)((x) + 0.5) : (long)((x) - 0.5))
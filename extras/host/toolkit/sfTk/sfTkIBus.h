@@ -0,0 +1,105 @@
+/**
+ * @file    sfTkIBus.h
+ * @brief   Host stand-in for the bus interface of the SparkFun Toolkit
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares the sfTkIBus interface with the calls the Qwiic
+ *          Buzzer library makes, with the same signatures as the SparkFun
+ *          Toolkit. Only the host build in extras/host uses it.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfToolkit.h"
+
+class sfTkIBus
+{
+  public:
+    virtual ~sfTkIBus()
+    {
+    }
+
+    /// @brief Writes raw data to the device
+    /// @param data Data to write
+    /// @param length Number of bytes
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    virtual sfTkError_t writeData(const uint8_t *data, size_t length) = 0;
+
+    /// @brief Writes registers of the device
+    /// @param devReg Register pointer
+    /// @param regLength Length of the register pointer
+    /// @param data Data to write
+    /// @param length Number of bytes
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    virtual sfTkError_t writeRegister(uint8_t *devReg, size_t regLength, const uint8_t *data, size_t length) = 0;
+
+    /// @brief Writes registers of the device, with a one byte register pointer
+    /// @param devReg Register pointer
+    /// @param data Data to write
+    /// @param length Number of bytes
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t writeRegister(uint8_t devReg, const uint8_t *data, size_t length)
+    {
+        return writeRegister(&devReg, 1, data, length);
+    }
+
+    /// @brief Writes one register of the device
+    /// @param devReg Register pointer
+    /// @param data Value to write
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t writeRegister(uint8_t devReg, uint8_t data)
+    {
+        return writeRegister(&devReg, 1, &data, 1);
+    }
+
+    /// @brief Writes one register of the device
+    /// @param devReg Register pointer
+    /// @param data Value to write
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t writeRegisterUInt8(uint8_t devReg, uint8_t data)
+    {
+        return writeRegister(&devReg, 1, &data, 1);
+    }
+
+    /// @brief Reads registers of the device
+    /// @param devReg Register pointer
+    /// @param regLength Length of the register pointer
+    /// @param data Buffer for the data
+    /// @param numBytes Number of bytes to read
+    /// @param readBytes Number of bytes read
+    /// @param read_delay Delay between the write of the pointer and the read
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    virtual sfTkError_t readRegister(uint8_t *devReg, size_t regLength, uint8_t *data, size_t numBytes,
+                                     size_t &readBytes, uint32_t read_delay = 0) = 0;
+
+    /// @brief Reads registers of the device, with a one byte register pointer
+    /// @param devReg Register pointer
+    /// @param data Buffer for the data
+    /// @param numBytes Number of bytes to read
+    /// @param readBytes Number of bytes read
+    /// @param read_delay Delay between the write of the pointer and the read
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t readRegister(uint8_t devReg, uint8_t *data, size_t numBytes, size_t &readBytes,
+                             uint32_t read_delay = 0)
+    {
+        return readRegister(&devReg, 1, data, numBytes, readBytes, read_delay);
+    }
+
+    /// @brief Reads one register of the device
+    /// @param devReg Register pointer
+    /// @param data Value read
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t readRegister(uint8_t devReg, uint8_t &data)
+    {
+        size_t readBytes;
+        sfTkError_t err = readRegister(&devReg, 1, &data, 1, readBytes);
+        if (err == ksfTkErrOk && readBytes != 1)
+            err = ksfTkErrFail;
+        return err;
+    }
+};
@@ -0,0 +1,49 @@
+/**
+ * @file    sfTkII2C.h
+ * @brief   Host stand-in for the I2C bus interface of the SparkFun Toolkit
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares the sfTkII2C interface, an sfTkIBus with a device
+ *          address, with the same signatures as the SparkFun Toolkit. Only the
+ *          host build in extras/host uses it.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfTkIBus.h"
+
+class sfTkII2C : public sfTkIBus
+{
+  public:
+    /// @brief Constructor
+    /// @param address 7-bit address of the device
+    sfTkII2C(uint8_t address = 0) : _address{address}
+    {
+    }
+
+    /// @brief Pings the device
+    /// @return 0 if the device answers, negative for errors
+    virtual sfTkError_t ping() = 0;
+
+    /// @brief Sets the address of the device
+    /// @param devAddr 7-bit address
+    virtual void setAddress(uint8_t devAddr)
+    {
+        _address = devAddr;
+    }
+
+    /// @brief Gets the address of the device
+    /// @return 7-bit address
+    virtual uint8_t address(void)
+    {
+        return _address;
+    }
+
+  private:
+    uint8_t _address;
+};
@@ -0,0 +1,34 @@
+/**
+ * @file    sfToolkit.h
+ * @brief   Host stand-in for the core header of the SparkFun Toolkit
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares the parts of the SparkFun Toolkit core that the
+ *          Qwiic Buzzer library uses (error codes, and the millisecond clock),
+ *          so that the library can be built and tested on a host computer,
+ *          without Arduino. Only the host build in extras/host uses it; on a
+ *          board, the real SparkFun Toolkit library is used.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int32_t sfTkError_t;
+
+const sfTkError_t ksfTkErrOk = 0;
+const sfTkError_t ksfTkErrFail = -1;
+
+/// @brief Gets the time since the program started
+/// @return Time in milliseconds
+uint32_t sftk_ticks_ms(void);
+
+/// @brief Waits
+/// @param ms Number of milliseconds
+void sftk_delay_ms(uint32_t ms);
@@ -0,0 +1,34 @@
+/**
+ * @file    sfToolkit.cpp
+ * @brief   Host implementation of the clock of the SparkFun Toolkit
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file implements sftk_ticks_ms() and sftk_delay_ms() with the
+ *          C++ standard library, for the host build in extras/host. Tests and
+ *          benchmarks give the buzzers an sfDevBuzzerMockClock instead, so they
+ *          never actually wait.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include <sfTk/sfToolkit.h>
+
+#include <chrono>
+#include <thread>
+
+static const std::chrono::steady_clock::time_point kStart = std::chrono::steady_clock::now();
+
+uint32_t sftk_ticks_ms(void)
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - kStart)
+        .count();
+}
+
+void sftk_delay_ms(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
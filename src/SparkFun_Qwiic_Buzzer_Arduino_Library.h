@@ -19,6 +19,14 @@
 // clang-format off
 #include <SparkFun_Toolkit.h>
 #include "sfTk/sfDevBuzzer.h"
+#include "sfTk/sfDevBuzzerAlerts.h"
+#include "sfTk/sfDevBuzzerGroup.h"
+#include "sfTk/sfDevBuzzerMelody.h"
+#include "sfTk/sfDevBuzzerProvision.h"
+#include "sfTk/sfDevBuzzerRtttl.h"
+#include "sfTk/sfDevBuzzerScan.h"
+#include "sfTk/sfDevBuzzerStatic.h"
+#include "sfTk/sfDevBuzzerVoices.h"
 // clang-format on
 class QwiicBuzzer : public sfDevBuzzer
 {
@@ -29,9 +37,19 @@ class QwiicBuzzer : public sfDevBuzzer
     /// @return True if successful, false otherwise
     bool begin(const uint8_t address = SFE_QWIIC_BUZZER_DEFAULT_ADDRESS, TwoWire &wirePort = Wire)
     {
+        // Fails to link if the library was built with another effect mask, or
+        // with the instrumentation set differently
+        sfDevBuzzerEffectMask<SFE_QWIIC_BUZZER_EFFECT_MASK>::linked();
+        sfDevBuzzerInstrumentationFlag<SFE_QWIIC_BUZZER_INSTRUMENTATION>::linked();
+
         // Setup Arudino I2C bus
         _theI2CBus.init(wirePort, address);
 
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+        // Time the calls with micros()
+        setInstrumentationClock(clockUs);
+#endif
+
         // Begin the sensor
         return sfDevBuzzer::begin(&_theI2CBus) == ksfTkErrOk;
     }
@@ -43,6 +61,118 @@ class QwiicBuzzer : public sfDevBuzzer
         return sfDevBuzzer::isConnected() == ksfTkErrOk;
     }
 
+    /// @brief Finds all the Qwiic Buzzers on a Wire port, and begins one
+    /// QwiicBuzzer per buzzer found, in order of address. Each address is
+    /// probed once, and the buzzers found are not probed again by begin().
+    /// @param buzzers Array of buzzers to begin
+    /// @param maxCount Size of buzzers, the scan stops when it is full
+    /// @param wirePort Wire port to scan
+    /// @param exclude Addresses of other devices not to probe, nullptr for none
+    /// @return Number of buzzers found and begun
+    static uint8_t beginAll(QwiicBuzzer *buzzers, const uint8_t maxCount, TwoWire &wirePort = Wire,
+                            const sfDevBuzzerAddressSet *exclude = nullptr)
+    {
+        // Fails to link if the library was built with another effect mask, or
+        // with the instrumentation set differently
+        sfDevBuzzerEffectMask<SFE_QWIIC_BUZZER_EFFECT_MASK>::linked();
+        sfDevBuzzerInstrumentationFlag<SFE_QWIIC_BUZZER_INSTRUMENTATION>::linked();
+
+        if (buzzers == nullptr || maxCount == 0)
+            return 0;
+
+        // The first buzzer's bus does the scan, its address is restored after
+        // each call
+        sfTkArdI2C *scanBus = &buzzers[0]._theI2CBus;
+        scanBus->init(wirePort, SFE_QWIIC_BUZZER_DEFAULT_ADDRESS);
+
+        uint8_t count = 0;
+        uint8_t address = sfDevBuzzerScanNext(scanBus, SFE_QWIIC_BUZZER_ADDRESS_MIN, exclude);
+        while (address != 0 && count < maxCount)
+        {
+            QwiicBuzzer &buzzer = buzzers[count++];
+            buzzer._theI2CBus.init(wirePort, address);
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+            buzzer.setInstrumentationClock(clockUs);
+#endif
+            buzzer.beginWithoutProbe(&buzzer._theI2CBus);
+
+            if (count < maxCount)
+                address = sfDevBuzzerScanNext(scanBus, address + 1, exclude);
+        }
+        return count;
+    }
+
+  private:
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+    static uint32_t clockUs()
+    {
+        return micros();
+    }
+#endif
+
+    sfTkArdI2C _theI2CBus;
+};
+
+/// @brief A Qwiic Buzzer on a sfTkArdI2C bus, with the bus calls bound at
+/// compile time. Address fixes the address of the buzzer, so that several
+/// buzzers can share one bus, see sfDevBuzzerT.
+template <uint8_t Address = 0> using QwiicBuzzerT = sfDevBuzzerT<sfTkArdI2C, Address>;
+
+class QwiicBuzzerGroup : public sfDevBuzzerGroup
+{
+  public:
+    /// @brief Constructor, measures the start skew with micros()
+    QwiicBuzzerGroup() : sfDevBuzzerGroup(clockUs)
+    {
+    }
+
+  private:
+    static uint32_t clockUs()
+    {
+        return micros();
+    }
+};
+
+class QwiicBuzzerMelodyStream : public sfDevBuzzerMelodySource
+{
+  public:
+    /// @brief Constructor
+    /// @param stream Stream the packed melody is received on (e.g. Serial). The
+    /// melody must end with SFE_QWIIC_BUZZER_MELODY_END.
+    QwiicBuzzerMelodyStream(Stream &stream) : _stream{stream}
+    {
+    }
+
+    /// @brief Reads the next byte of the melody
+    /// @return The byte, or SFE_QWIIC_BUZZER_MELODY_SOURCE_WAIT if it has not
+    /// arrived yet
+    int16_t read()
+    {
+        int value = _stream.read();
+        return value < 0 ? SFE_QWIIC_BUZZER_MELODY_SOURCE_WAIT : value;
+    }
+
+  private:
+    Stream &_stream;
+};
+
+class QwiicBuzzerProvisioner : public sfDevBuzzerProvisioner
+{
+  public:
+    /// @brief Starts provisioning the buzzers attached to a Wire port
+    /// @param targets Addresses to give the buzzers, in order. The array must
+    /// stay valid until provisioning is done.
+    /// @param count Number of addresses in targets
+    /// @param wirePort Wire port the buzzers are attached to
+    /// @return True if successful, false otherwise
+    bool begin(const uint8_t *targets, const uint8_t count, TwoWire &wirePort = Wire)
+    {
+        // Setup Arudino I2C bus
+        _theI2CBus.init(wirePort, SFE_QWIIC_BUZZER_DEFAULT_ADDRESS);
+
+        return sfDevBuzzerProvisioner::begin(&_theI2CBus, targets, count) == ksfTkErrOk;
+    }
+
   private:
     sfTkArdI2C _theI2CBus;
 };
@@ -18,7 +18,38 @@
 
 #include "sfDevBuzzer.h"
 
+#include <string.h>
+
+// Instrumentation hooks, compiled out unless SFE_QWIIC_BUZZER_INSTRUMENTATION is 1
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+#define SFE_QWIIC_BUZZER_API_SCOPE(api) sfDevBuzzerApiScope apiScope(this, api)
+#define SFE_QWIIC_BUZZER_COUNT_TRANSACTION(bytes) countTransaction(bytes)
+#else
+#define SFE_QWIIC_BUZZER_API_SCOPE(api)
+#define SFE_QWIIC_BUZZER_COUNT_TRANSACTION(bytes)
+#endif
+
+// Only the instrumentation setting the library is compiled with links, see
+// sfDevBuzzerInstrumentationFlag
+template <uint8_t Enabled> void sfDevBuzzerInstrumentationFlag<Enabled>::linked()
+{
+}
+
+template struct sfDevBuzzerInstrumentationFlag<SFE_QWIIC_BUZZER_INSTRUMENTATION>;
+
 sfTkError_t sfDevBuzzer::begin(sfTkII2C *theBus)
+{
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiOther);
+
+    sfTkError_t err;
+    err = beginWithoutProbe(theBus);
+    if (err != ksfTkErrOk)
+        return err;
+
+    return probe();
+}
+
+sfTkError_t sfDevBuzzer::beginWithoutProbe(sfTkII2C *theBus)
 {
     // Nullptr check
     if (theBus == nullptr)
@@ -27,6 +58,16 @@ sfTkError_t sfDevBuzzer::begin(sfTkII2C *theBus)
     // Set bus pointer
     _theBus = theBus;
 
+    // Nothing is known about the registers of this device yet
+    invalidateCache();
+    _savedValid = false;
+    _savePending = false;
+
+    return ksfTkErrOk;
+}
+
+sfTkError_t sfDevBuzzer::probe()
+{
     sfTkError_t err;
     err = isConnected();
     // Check whether the ping was successful
@@ -50,18 +91,19 @@ sfTkError_t sfDevBuzzer::begin(sfTkII2C *theBus)
 sfTkError_t sfDevBuzzer::isConnected()
 {
     // Just ping the device address
+    SFE_QWIIC_BUZZER_COUNT_TRANSACTION(0);
     return _theBus->ping();
 }
 
 sfTkError_t sfDevBuzzer::deviceId(uint8_t &deviceId)
 {
-    return _theBus->readRegister(kSfeQwiicBuzzerRegId, deviceId);
+    return readRegisters(kSfeQwiicBuzzerRegId, &deviceId, 1);
 }
 
 bool sfDevBuzzer::firmwareVersionMajor(uint8_t &versionMajor)
 {
     sfTkError_t err;
-    err = _theBus->readRegister(kSfeQwiicBuzzerRegFirmwareMajor, versionMajor);
+    err = readRegisters(kSfeQwiicBuzzerRegFirmwareMajor, &versionMajor, 1);
     if (err == ksfTkErrOk)
         return true;
     else
@@ -71,18 +113,76 @@ bool sfDevBuzzer::firmwareVersionMajor(uint8_t &versionMajor)
 bool sfDevBuzzer::firmwareVersionMinor(uint8_t &versionMinor)
 {
     sfTkError_t err;
-    err = _theBus->readRegister(kSfeQwiicBuzzerRegFirmwareMinor, versionMinor);
+    err = readRegisters(kSfeQwiicBuzzerRegFirmwareMinor, &versionMinor, 1);
     if (err == ksfTkErrOk)
         return true;
     else
         return false;
 }
 
+sfTkError_t sfDevBuzzer::readConfig(sfDevBuzzerConfig &config)
+{
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiConfig);
+
+    // All of the registers are in sequential order, starting at
+    // "kSfeQwiicBuzzerRegId", so they can all be read in one burst
+    uint8_t data[SFE_QWIIC_BUZZER_REGISTER_COUNT];
+    sfTkError_t err = readRegisters(kSfeQwiicBuzzerRegId, data, SFE_QWIIC_BUZZER_REGISTER_COUNT);
+
+    // Check whether the read was successful
+    if (err != ksfTkErrOk)
+        return err;
+
+    config.deviceId = data[kSfeQwiicBuzzerRegId];
+    config.firmwareMinor = data[kSfeQwiicBuzzerRegFirmwareMinor];
+    config.firmwareMajor = data[kSfeQwiicBuzzerRegFirmwareMajor];
+    config.toneFrequency = (data[kSfeQwiicBuzzerRegToneFrequencyMsb] << 8) | data[kSfeQwiicBuzzerRegToneFrequencyLsb];
+    config.volume = data[kSfeQwiicBuzzerRegVolume];
+    config.duration = (data[kSfeQwiicBuzzerRegDurationMsb] << 8) | data[kSfeQwiicBuzzerRegDurationLsb];
+    config.active = data[kSfeQwiicBuzzerRegActive] != 0;
+    config.address = data[kSfeQwiicBuzzerRegI2cAddress];
+
+    // The device now holds exactly these values
+    _registerCache.fill(&data[kSfeQwiicBuzzerRegToneFrequencyMsb]);
+
+    return ksfTkErrOk;
+}
+
+sfTkError_t sfDevBuzzer::writeConfig(const sfDevBuzzerConfig &config)
+{
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiConfig);
+
+    sfDevBuzzerNote note;
+    makeNote(note, config.toneFrequency, config.duration, config.volume);
+
+    sfTkError_t err;
+    if (config.active)
+        err = play(note);
+    else
+    {
+        note.registers[kSfeQwiicBuzzerRegActive - kSfeQwiicBuzzerRegToneFrequencyMsb] = 0;
+        err = _registerCache.write(*this, kSfeQwiicBuzzerRegToneFrequencyMsb, note.registers,
+                                   SFE_QWIIC_BUZZER_CACHED_REGISTERS);
+    }
+
+    // Check whether the write was successful
+    if (err != ksfTkErrOk)
+        return err;
+
+    if (config.address == address())
+        return ksfTkErrOk;
+
+    return setAddress(config.address);
+}
+
 sfTkError_t sfDevBuzzer::configureBuzzer(const uint16_t toneFrequency, const uint16_t duration, const uint8_t volume)
 {
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiConfigure);
+
     // All of the necessary configuration register addresses are in sequential order,
     // starting at "kSfeQwiicBuzzerRegToneFrequencyMsb".
-    // We can write all of them in a single use of "writeRegisterRegion()".
+    // We can write all of them in a single use of "writeRegister()", and the
+    // register cache trims this down to the ones that actually changed.
 
     // kSfeQwiicBuzzerRegToneFrequencyMsb = 0x03,
     // kSfeQwiicBuzzerRegToneFrequencyLsb = 0x04,
@@ -90,47 +190,268 @@ sfTkError_t sfDevBuzzer::configureBuzzer(const uint16_t toneFrequency, const uin
     // kSfeQwiicBuzzerRegDurationMsb = 0x06,
     // kSfeQwiicBuzzerRegDurationLsb = 0x07,
 
-    // extract MSBs and LSBs from user passed in arguments
-    uint8_t toneFrequencyMSB = ((toneFrequency & 0xFF00) >> 8);
-    uint8_t toneFrequencyLSB = (toneFrequency & 0x00FF);
-    uint8_t durationMSB = ((duration & 0xFF00) >> 8);
-    uint8_t durationLSB = (duration & 0x00FF);
-
-    size_t dataLength = 5;
+    const size_t dataLength = 5;
     uint8_t data[dataLength];
+    fillConfiguration(data, toneFrequency, duration, volume);
+
+    return _registerCache.write(*this, kSfeQwiicBuzzerRegToneFrequencyMsb, data, dataLength);
+}
+
+sfTkError_t sfDevBuzzer::play(const uint16_t toneFrequency, const uint16_t duration, const uint8_t volume)
+{
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiPlay);
+
+    sfDevBuzzerNote note;
+    makeNote(note, toneFrequency, duration, volume);
+
+    return play(note);
+}
+
+sfTkError_t sfDevBuzzer::play(const sfDevBuzzerNote &note)
+{
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiPlay);
+
+    const uint8_t msb = kSfeQwiicBuzzerRegDurationMsb - kSfeQwiicBuzzerRegToneFrequencyMsb;
+    const uint8_t lsb = kSfeQwiicBuzzerRegDurationLsb - kSfeQwiicBuzzerRegToneFrequencyMsb;
+
+    // The configuration registers and kSfeQwiicBuzzerRegActive (0x08) follow
+    // each other, so the whole note is a single 6 byte write
+    sfTkError_t err = _registerCache.writeNote(*this, note.registers);
+
+    // Check whether the write was successful
+    if (err == ksfTkErrOk)
+        armIdleWatch((note.registers[msb] << 8) | note.registers[lsb]);
+
+    return err;
+}
 
-    data[0] = toneFrequencyMSB; // kSfeQwiicBuzzerRegToneFrequencyMsb
-    data[1] = toneFrequencyLSB; // kSfeQwiicBuzzerRegToneFrequencyLsb
-    data[2] = volume;           // kSfeQwiicBuzzerRegVolume
-    data[3] = durationMSB;      // kSfeQwiicBuzzerRegDurationMsb
-    data[4] = durationLSB;      // kSfeQwiicBuzzerRegDurationLsb
+void sfDevBuzzer::makeNote(sfDevBuzzerNote &note, const uint16_t toneFrequency, const uint16_t duration,
+                           const uint8_t volume)
+{
+    fillConfiguration(note.registers, toneFrequency, duration, volume);
+    note.registers[kSfeQwiicBuzzerRegActive - kSfeQwiicBuzzerRegToneFrequencyMsb] = 1;
+}
 
-    return _theBus->writeRegister(kSfeQwiicBuzzerRegToneFrequencyMsb, data, dataLength);
+void sfDevBuzzer::makeNote(sfDevBuzzerNote &note, const sfDevBuzzerPitch &pitch, const uint16_t duration,
+                           const uint8_t volume)
+{
+    fillConfiguration(note.registers, 0, duration, volume);
+    note.registers[kSfeQwiicBuzzerRegToneFrequencyMsb - kSfeQwiicBuzzerRegToneFrequencyMsb] = pitch.msb;
+    note.registers[kSfeQwiicBuzzerRegToneFrequencyLsb - kSfeQwiicBuzzerRegToneFrequencyMsb] = pitch.lsb;
+    note.registers[kSfeQwiicBuzzerRegActive - kSfeQwiicBuzzerRegToneFrequencyMsb] = 1;
 }
 
 sfTkError_t sfDevBuzzer::on()
 {
-    return _theBus->writeRegisterUInt8(kSfeQwiicBuzzerRegActive, 1);
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiOn);
+
+    sfTkError_t err = _registerCache.writeActive(*this, 1);
+
+    // Check whether the write was successful. The duration is only known if
+    // it is in the cache.
+    uint16_t duration;
+    if (err == ksfTkErrOk && _registerCache.duration(duration))
+        armIdleWatch(duration);
+
+    return err;
+}
+
+sfTkError_t sfDevBuzzer::tryOn()
+{
+    _singleAttempt = true;
+    sfTkError_t err = on();
+    _singleAttempt = false;
+
+    return err;
 }
 
 sfTkError_t sfDevBuzzer::off()
 {
-    return _theBus->writeRegisterUInt8(kSfeQwiicBuzzerRegActive, 0);
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiOff);
+
+    // Turned off on purpose, there is no end of buzz to report
+    _idleArmed = false;
+
+    return _registerCache.writeActive(*this, 0);
+}
+
+sfTkError_t sfDevBuzzer::isActive(bool &active)
+{
+    uint8_t value;
+    sfTkError_t err = readRegisters(kSfeQwiicBuzzerRegActive, &value, 1);
+    // Check whether the read was successful
+    if (err != ksfTkErrOk)
+        return err;
+
+    active = value != 0;
+    return ksfTkErrOk;
+}
+
+void sfDevBuzzer::setIdleCallback(sfDevBuzzerIdleCallback callback, void *context)
+{
+    _idleCallback = callback;
+    _idleContext = context;
+    _idleArmed = false;
+}
+
+void sfDevBuzzer::invalidateCache()
+{
+    _registerCache.invalidate();
+}
+
+void sfDevBuzzer::fillConfiguration(uint8_t *data, const uint16_t toneFrequency, const uint16_t duration,
+                                    const uint8_t volume)
+{
+    // kSfeQwiicBuzzerRegToneFrequencyMsb = 0x03,
+    // kSfeQwiicBuzzerRegToneFrequencyLsb = 0x04,
+    // kSfeQwiicBuzzerRegVolume = 0x05,
+    // kSfeQwiicBuzzerRegDurationMsb = 0x06,
+    // kSfeQwiicBuzzerRegDurationLsb = 0x07,
+
+    // extract MSBs and LSBs from user passed in arguments
+    data[0] = ((toneFrequency & 0xFF00) >> 8); // kSfeQwiicBuzzerRegToneFrequencyMsb
+    data[1] = (toneFrequency & 0x00FF);        // kSfeQwiicBuzzerRegToneFrequencyLsb
+    data[2] = volume;                          // kSfeQwiicBuzzerRegVolume
+    data[3] = ((duration & 0xFF00) >> 8);      // kSfeQwiicBuzzerRegDurationMsb
+    data[4] = (duration & 0x00FF);             // kSfeQwiicBuzzerRegDurationLsb
 }
 
 sfTkError_t sfDevBuzzer::saveSettings()
 {
-    return _theBus->writeRegisterUInt8(kSfeQwiicBuzzerRegSaveSettings, 1);
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiSaveSettings);
+
+    // Nothing changed since the last save, no need to wear the EEPROM
+    if (!settingsDirty())
+    {
+        _savesAvoided++;
+        return ksfTkErrOk;
+    }
+
+    if (_saveInterval == 0)
+        return commitSettings();
+
+    // Queue it for update(), merging with a save already queued
+    if (_savePending)
+        _savesAvoided++;
+    _savePending = true;
+
+    return ksfTkErrOk;
+}
+
+void sfDevBuzzer::setSaveInterval(const uint32_t intervalMs)
+{
+    _saveInterval = intervalMs;
+}
+
+sfTkError_t sfDevBuzzer::flushSettings()
+{
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiSaveSettings);
+
+    if (!_savePending)
+        return ksfTkErrOk;
+
+    return commitSettings();
+}
+
+bool sfDevBuzzer::settingsDirty()
+{
+    // The live settings must be known to compare them
+    if (!_savedValid || !_registerCache.known(kSfeQwiicBuzzerRegToneFrequencyMsb, SFE_QWIIC_BUZZER_SAVED_REGISTERS))
+        return true;
+
+    return memcmp(_savedSettings, _registerCache.values(), SFE_QWIIC_BUZZER_SAVED_REGISTERS) != 0 ||
+           _savedAddress != address();
+}
+
+uint32_t sfDevBuzzer::savesAvoided()
+{
+    return _savesAvoided;
+}
+
+void sfDevBuzzer::setRetryPolicy(const sfDevBuzzerRetryPolicy &policy)
+{
+    _retryPolicy = policy;
+}
+
+void sfDevBuzzer::busStats(sfDevBuzzerBusStats &stats)
+{
+    stats = _busStats;
+}
+
+void sfDevBuzzer::setInstrumentationClock(uint32_t (*clockUs)(void))
+{
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+    _instrumentClockUs = clockUs;
+#else
+    (void)clockUs;
+#endif
+}
+
+void sfDevBuzzer::instrumentation(sfDevBuzzerInstrumentation &snapshot)
+{
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+    snapshot = _instrumentation;
+#else
+    memset(&snapshot, 0, sizeof(snapshot));
+#endif
+}
+
+void sfDevBuzzer::resetInstrumentation()
+{
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+    memset(&_instrumentation, 0, sizeof(_instrumentation));
+#endif
+}
+
+void sfDevBuzzer::resetBusStats()
+{
+    _busStats.errors = 0;
+    _busStats.retries = 0;
+    _busStats.failures = 0;
+    _busStats.rebegins = 0;
+    _busStats.aborts = 0;
+}
+
+sfTkError_t sfDevBuzzer::commitSettings()
+{
+    _savePending = false;
+
+    // The settings may have been changed back since the save was queued
+    if (!settingsDirty())
+    {
+        _savesAvoided++;
+        return ksfTkErrOk;
+    }
+
+    const uint8_t save = 1;
+    sfTkError_t err = writeRegisters(kSfeQwiicBuzzerRegSaveSettings, &save, 1);
+
+    // Check whether the write was successful. If not, what the EEPROM holds is
+    // unknown.
+    if (err != ksfTkErrOk)
+    {
+        _savedValid = false;
+        return err;
+    }
+
+    // The EEPROM now holds the live settings, as far as the cache knows them
+    memcpy(_savedSettings, _registerCache.values(), SFE_QWIIC_BUZZER_SAVED_REGISTERS);
+    _savedAddress = address();
+    _savedValid = _registerCache.known(kSfeQwiicBuzzerRegToneFrequencyMsb, SFE_QWIIC_BUZZER_SAVED_REGISTERS);
+
+    return ksfTkErrOk;
 }
 
 sfTkError_t sfDevBuzzer::setAddress(const uint8_t &address)
 {
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiSetAddress);
+
     if (address < 0x08 || address > 0x77)
     {
         return ksfTkErrFail; // error immediately if the address is out of legal range
     }
 
-    sfTkError_t err = _theBus->writeRegister(kSfeQwiicBuzzerRegI2cAddress, address);
+    sfTkError_t err = writeRegisters(kSfeQwiicBuzzerRegI2cAddress, &address, 1);
 
     // Check whether the write was successful
     if (err != ksfTkErrOk)
@@ -150,495 +471,613 @@ uint8_t sfDevBuzzer::address()
 
 bool sfDevBuzzer::playSoundEffect(const uint8_t soundEffectNumber, const uint8_t volume)
 {
-    sfTkError_t err;
-
-    switch (soundEffectNumber)
-    {
-    case 0:
-        err = soundEffect0(volume);
-        break;
-    case 1:
-        err = soundEffect1(volume);
-        break;
-    case 2:
-        err = soundEffect2(volume);
-        break;
-    case 3:
-        err = soundEffect3(volume);
-        break;
-    case 4:
-        err = soundEffect4(volume);
-        break;
-    case 5:
-        err = soundEffect5(volume);
-        break;
-    case 6:
-        err = soundEffect6(volume);
-        break;
-    case 7:
-        err = soundEffect7(volume);
-        break;
-    case 8:
-        err = soundEffect8(volume);
-        break;
-    case 9:
-        err = soundEffect9(volume);
-        break;
-    default:
-        err = ksfTkErrFail;
-    }
+    const sfDevBuzzerEffect *effect = findSoundEffect(soundEffectNumber);
+    if (effect == nullptr)
+        return false;
 
-    if (err == ksfTkErrOk)
+    if (playSoundEffect(*effect, volume) == ksfTkErrOk)
         return true;
     else
         return false;
 }
 
-sfTkError_t sfDevBuzzer::soundEffect0(const uint8_t volume)
+sfTkError_t sfDevBuzzer::playSoundEffect(const sfDevBuzzerEffect &effect, const uint8_t volume)
 {
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiEffect);
+
+    // Run the non-blocking player to completion, sleeping until each step is due
+    startSoundEffect(effect, volume);
+
     sfTkError_t err;
-    for (int note = 150; note < 4000; note += 150)
+    uint32_t wait;
+    bool played;
+    uint32_t now = ticksMs();
+    while (isPlaying())
     {
-        err = configureBuzzer(note, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        if (!_effect.pending)
+        {
+            int32_t early = (int32_t)(_effect.due - now);
+            if (early > 0)
+            {
+                delayMs(early);
+                now = ticksMs();
+            }
+        }
 
-        err = on();
+        err = stepSoundEffect(wait, played);
         // Check whether the write was successful
         if (err != ksfTkErrOk)
+        {
+            abortSoundEffect();
             return err;
+        }
 
-        sftk_delay_ms(10);
+        scheduleSoundEffect(now, wait, played);
+        now = ticksMs();
     }
-    for (int note = 4000; note > 150; note -= 150)
-    {
-        err = configureBuzzer(note, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+    return ksfTkErrOk;
+}
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+bool sfDevBuzzer::startSoundEffect(const uint8_t soundEffectNumber, const uint8_t volume)
+{
+    const sfDevBuzzerEffect *effect = findSoundEffect(soundEffectNumber);
+    if (effect == nullptr)
+        return false;
 
-        sftk_delay_ms(10);
-    }
-    return off();
+    startSoundEffect(*effect, volume);
+    return true;
 }
 
-sfTkError_t sfDevBuzzer::soundEffect1(const uint8_t volume)
+void sfDevBuzzer::startSoundEffect(const sfDevBuzzerEffect &effect, const uint8_t volume)
 {
-    sfTkError_t err;
-    for (int i = 0; i <= 2; i++)
+    // The first step is played on the next call to update()
+    sfDevBuzzerReadProgmem(&_effect.effect, &effect, sizeof(sfDevBuzzerEffect));
+    _effect.segment = 0;
+    _effect.pass = 0;
+    _effect.frequency = 0;
+    _effect.started = false;
+    _effect.volume = volume;
+    _effect.pending = true;
+}
+
+sfTkError_t sfDevBuzzer::update(const uint32_t nowMs)
+{
+    sfTkError_t err = ksfTkErrOk;
+
+    // Nothing to write until the next step is due
+    if (isPlaying() && (_effect.pending || (int32_t)(nowMs - _effect.due) >= 0))
     {
-        for (int note = 150; note < 4000; note += 150)
-        {
-            err = configureBuzzer(note, 0, volume);
-            // Check whether the write was successful
-            if (err != ksfTkErrOk)
-                return err;
+        SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiEffect);
 
-            err = on();
-            // Check whether the write was successful
-            if (err != ksfTkErrOk)
-                return err;
+        uint32_t wait;
+        bool played;
+        err = stepSoundEffect(wait, played);
+        scheduleSoundEffect(nowMs, wait, played);
 
-            sftk_delay_ms(2);
-        }
-        for (int note = 4000; note > 150; note -= 150)
-        {
-            err = configureBuzzer(note, 0, volume);
-            // Check whether the write was successful
-            if (err != ksfTkErrOk)
-                return err;
+        // Check whether the write was successful. If not, the buzzer may be
+        // left on by the previous step.
+        if (err != ksfTkErrOk)
+            abortSoundEffect();
+    }
 
-            err = on();
-            // Check whether the write was successful
-            if (err != ksfTkErrOk)
-                return err;
+    if (_idleArmed)
+    {
+        SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiOther);
 
-            sftk_delay_ms(2);
-        }
+        sfTkError_t idleErr = pollIdle(nowMs);
+        if (err == ksfTkErrOk)
+            err = idleErr;
     }
-    return off();
+
+    // Commit a queued save once the interval since the last one has passed
+    if (_savePending && (!_saveTimed || nowMs - _lastSave >= _saveInterval))
+    {
+        SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiSaveSettings);
+
+        sfTkError_t saveErr = commitSettings();
+        _lastSave = nowMs;
+        _saveTimed = true;
+        if (err == ksfTkErrOk)
+            err = saveErr;
+    }
+
+    return err;
 }
 
-sfTkError_t sfDevBuzzer::soundEffect2(const uint8_t volume)
+bool sfDevBuzzer::isPlaying()
 {
-    sfTkError_t err;
-    for (int note = 150; note < 4000; note += 150)
-    {
-        err = configureBuzzer(note, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+    return _effect.effect.segments != nullptr;
+}
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+sfTkError_t sfDevBuzzer::stopSoundEffect()
+{
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiEffect);
 
-        sftk_delay_ms(40);
-    }
+    _effect.effect.segments = nullptr;
     return off();
 }
 
-sfTkError_t sfDevBuzzer::soundEffect3(const uint8_t volume)
+void sfDevBuzzer::setEffectTiming(const sfDevBuzzerEffectTiming timing, const uint16_t slackMs)
 {
-    sfTkError_t err;
-    for (int note = 150; note < 4000; note += 150)
+    _effectTiming = timing;
+    _effectSlack = slackMs;
+}
+
+sfTkError_t sfDevBuzzer::glide(const uint16_t fromHz, const uint16_t toHz, const uint16_t durationMs,
+                               const sfDevBuzzerGlideCurve curve, const uint8_t volume)
+{
+    SFE_QWIIC_BUZZER_API_SCOPE(kSfeQwiicBuzzerApiEffect);
+
+    uint16_t steps = sfDevBuzzerGlideSteps(fromHz, toHz, durationMs, curve, _writeBudget);
+    uint32_t now = ticksMs();
+    uint32_t due = now;
+    for (uint16_t step = 0; step < steps; step++)
     {
-        err = configureBuzzer(note, 0, volume);
+        sfTkError_t err = play(sfDevBuzzerGlideFrequency(fromHz, toHz, step, steps, curve), 0, volume);
         // Check whether the write was successful
         if (err != ksfTkErrOk)
+        {
+            // Best effort, don't leave the buzzer on
+            _registerCache.invalidateActive();
+            off();
             return err;
+        }
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        // Spread the rounding of the step lengths over the whole glide
+        uint32_t length = (uint32_t)(step + 1) * durationMs / steps - (uint32_t)step * durationMs / steps;
+        sfDevBuzzerScheduleStep(_timingStats, due, now, length);
 
-        sftk_delay_ms(10);
+        // Sleep until the next step is due, the time of the write included
+        now = ticksMs();
+        int32_t early = (int32_t)(due - now);
+        if (early > 0)
+        {
+            delayMs(early);
+            now = ticksMs();
+        }
     }
+
     return off();
 }
 
-sfTkError_t sfDevBuzzer::soundEffect4(const uint8_t volume)
+void sfDevBuzzer::setWriteBudget(const uint16_t writesPerSecond)
 {
-    sfTkError_t err;
-    for (int note = 4000; note > 150; note -= 150)
-    {
-        err = configureBuzzer(note, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+    _writeBudget = writesPerSecond;
+}
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+void sfDevBuzzer::timingStats(sfDevBuzzerTimingStats &stats)
+{
+    stats = _timingStats;
+}
 
-        sftk_delay_ms(40);
-    }
-    return off();
+void sfDevBuzzer::resetTimingStats()
+{
+    memset(&_timingStats, 0, sizeof(_timingStats));
 }
 
-sfTkError_t sfDevBuzzer::soundEffect5(const uint8_t volume)
+void sfDevBuzzer::setTimingClock(sfDevBuzzerClock *clock)
 {
-    sfTkError_t err;
-    for (int note = 4000; note > 150; note -= 150)
-    {
-        err = configureBuzzer(note, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+    _clock = clock;
+}
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+void sfDevBuzzer::soundEffectState(sfDevBuzzerEffectState &state)
+{
+    state = _effect;
+}
 
-        sftk_delay_ms(10);
-    }
-    return off();
+void sfDevBuzzer::resumeSoundEffect(const sfDevBuzzerEffectState &state)
+{
+    _effect = state;
+    _effect.pending = true;
 }
 
-sfTkError_t sfDevBuzzer::soundEffect6(const uint8_t volume)
+bool sfDevBuzzer::registerSoundEffect(const uint8_t soundEffectNumber, const sfDevBuzzerEffect *effect)
 {
-    sfTkError_t err;
-    int laughdelay = 400;
-    int laughstep = 10;
-    uint16_t i;
+    if (soundEffectNumber < SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT ||
+        soundEffectNumber >= SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT + SFE_QWIIC_BUZZER_USER_EFFECT_COUNT)
+        return false;
 
-    for (i = 1538; i < 1905; i += laughstep) // vary up //1538, 1905
+    _userEffects[soundEffectNumber - SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT] = effect;
+    return true;
+}
+
+const sfDevBuzzerEffect *sfDevBuzzer::findSoundEffect(const uint8_t soundEffectNumber)
+{
+    // Built-in effects left out of SFE_QWIIC_BUZZER_EFFECT_MASK are rejected
+    if (soundEffectNumber < SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT)
     {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+#if SFE_QWIIC_BUZZER_EFFECT_MASK
+        if (sfDevBuzzerEffectSelected(soundEffectNumber))
+            return &kSfeQwiicBuzzerSoundEffects[soundEffectNumber];
+#endif
+        return nullptr;
+    }
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+    if (soundEffectNumber < SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT + SFE_QWIIC_BUZZER_USER_EFFECT_COUNT)
+        return _userEffects[soundEffectNumber - SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT];
 
-        sftk_delay_ms(10);
-    }
-    err = off();
-    // Check whether the write was successful
-    if (err != ksfTkErrOk)
-        return err;
+    return nullptr;
+}
 
-    sftk_delay_ms(laughdelay);
+sfTkError_t sfDevBuzzer::stepSoundEffect(uint32_t &wait, bool &played)
+{
+    sfDevBuzzerSegment segment;
+    sfTkError_t err;
 
-    for (i = 1250; i < 1515; i += laughstep) // 1250, 1515
+    wait = 0;
+    played = true;
+    while (true)
     {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        // End of the segment list, either start the next repetition or finish
+        if (_effect.segment >= _effect.effect.segmentCount)
+        {
+            if (_effect.pass + 1 < _effect.effect.repeat)
+            {
+                _effect.pass++;
+                _effect.segment = 0;
+                continue;
+            }
+            played = false;
+            return finishSoundEffect(wait);
+        }
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        sfDevBuzzerReadProgmem(&segment, &_effect.effect.segments[_effect.segment], sizeof(sfDevBuzzerSegment));
 
-        sftk_delay_ms(10);
-    }
-    err = off();
-    // Check whether the write was successful
-    if (err != ksfTkErrOk)
-        return err;
-    sftk_delay_ms(laughdelay);
+        // Rest: silence the buzzer for the length of the segment
+        if (segment.step == 0)
+        {
+            bool first = _effect.segment == 0 && _effect.pass == 0;
+            _effect.segment++;
+            _effect.frequency = 0;
+            _effect.started = false;
+            wait = segment.dwell;
 
-    for (i = 1111; i < 1342; i += laughstep) // 1111, 1342
-    {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+            // A device-timed step before the rest has already turned itself off
+            if (_effectTiming != kSfeQwiicBuzzerTimingHost && !first)
+                return ksfTkErrOk;
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
+            err = off();
+            // Check whether the write was successful
+            if (err != ksfTkErrOk)
+                _effect.effect.segments = nullptr;
             return err;
+        }
 
-        sftk_delay_ms(10);
-    }
-    err = off();
-    // Check whether the write was successful
-    if (err != ksfTkErrOk)
-        return err;
-    sftk_delay_ms(laughdelay);
+        // Next frequency of the segment, and whether it is its last step
+        uint16_t note;
+        bool last;
+        if (sfDevBuzzerIsGlide(segment))
+        {
+            // For a glide, "frequency" counts the steps played
+            sfDevBuzzerGlideCurve curve = (sfDevBuzzerGlideCurve)(segment.step - SFE_QWIIC_BUZZER_GLIDE_STEP(0));
+            uint16_t steps =
+                sfDevBuzzerGlideSteps(segment.startFrequency, segment.endFrequency, segment.dwell, curve, _writeBudget);
+            uint16_t step = _effect.frequency;
+            if (step >= steps)
+            {
+                // Glide done, move on to the next segment
+                _effect.segment++;
+                _effect.frequency = 0;
+                _effect.started = false;
+                continue;
+            }
+
+            note = sfDevBuzzerGlideFrequency(segment.startFrequency, segment.endFrequency, step, steps, curve);
+            wait = (uint32_t)(step + 1) * segment.dwell / steps - (uint32_t)step * segment.dwell / steps;
+            _effect.frequency = step + 1;
+            _effect.started = true;
+            last = step + 1 >= steps;
+        }
+        else
+        {
+            // A sweep may start at 0Hz, so the frequency can't tell if it has started
+            int32_t next = !_effect.started ? segment.startFrequency : _effect.frequency + segment.step;
+            bool inRange = segment.step > 0 ? next < segment.endFrequency : next > segment.endFrequency;
+            if (!inRange)
+            {
+                // Sweep done, move on to the next segment
+                _effect.segment++;
+                _effect.frequency = 0;
+                _effect.started = false;
+                continue;
+            }
+
+            note = next;
+            wait = segment.dwell;
+            _effect.frequency = note;
+            _effect.started = true;
+
+            int32_t following = next + segment.step;
+            last = segment.step > 0 ? following >= segment.endFrequency : following <= segment.endFrequency;
+        }
 
-    for (i = 1010; i < 1176; i += laughstep) // 1010, 1176
-    {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        // Device-timed steps turn themselves off. A step followed by a rest or
+        // the end of the effect ends right on time, the others overlap the
+        // next step a little.
+        uint32_t duration = 0;
+        if (_effectTiming != kSfeQwiicBuzzerTimingHost)
+        {
+            bool silenceNext = false;
+            if (last)
+            {
+                uint8_t next = _effect.segment + 1;
+                if (next >= _effect.effect.segmentCount && _effect.pass + 1 < _effect.effect.repeat)
+                    next = 0;
+
+                silenceNext = true;
+                if (next < _effect.effect.segmentCount)
+                {
+                    sfDevBuzzerSegment nextSegment;
+                    sfDevBuzzerReadProgmem(&nextSegment, &_effect.effect.segments[next], sizeof(sfDevBuzzerSegment));
+                    silenceNext = nextSegment.step == 0;
+                }
+            }
+            duration = wait + (silenceNext ? 0 : _effectSlack);
+            if (duration == 0)
+                duration = 1;
+            if (duration > 0xFFFF)
+                duration = 0xFFFF;
+        }
 
-        err = on();
+        err = play(note, duration, _effect.volume);
         // Check whether the write was successful
         if (err != ksfTkErrOk)
-            return err;
-
-        sftk_delay_ms(10);
+            _effect.effect.segments = nullptr;
+        return err;
     }
-    return off();
 }
 
-sfTkError_t sfDevBuzzer::soundEffect7(const uint8_t volume)
+void sfDevBuzzer::scheduleSoundEffect(const uint32_t nowMs, const uint32_t wait, const bool played)
 {
-    sfTkError_t err;
-    int laughdelay = 200;
-    int laughstep = 15;
-    uint16_t i;
-
-    for (i = 1538; i < 1905; i += laughstep) // vary up //1538, 1905
+    // The first step, or the first one after a resume, starts the schedule
+    if (_effect.pending)
     {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
-
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
-
-        sftk_delay_ms(10);
+        _effect.pending = false;
+        _effect.due = nowMs;
     }
-    err = off();
-    // Check whether the write was successful
-    if (err != ksfTkErrOk)
-        return err;
-    sftk_delay_ms(laughdelay);
 
-    for (i = 1250; i < 1515; i += laughstep) // 1250, 1515
-    {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+    // Checking for the end of the effect is not a step
+    if (played)
+        sfDevBuzzerScheduleStep(_timingStats, _effect.due, nowMs, wait);
+    else
+        _effect.due = nowMs + wait;
+}
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+sfTkError_t sfDevBuzzer::finishSoundEffect(uint32_t &wait)
+{
+    wait = 0;
 
-        sftk_delay_ms(10);
+    if (_effectTiming == kSfeQwiicBuzzerTimingHost)
+    {
+        _effect.effect.segments = nullptr;
+        return off();
     }
-    err = off();
-    // Check whether the write was successful
-    if (err != ksfTkErrOk)
-        return err;
-    sftk_delay_ms(laughdelay);
 
-    for (i = 1111; i < 1342; i += laughstep) // 1111, 1342
+    if (_effectTiming == kSfeQwiicBuzzerTimingDevicePolled)
     {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
+        bool active;
+        sfTkError_t err = isActive(active);
+        // Check whether the read was successful
         if (err != ksfTkErrOk)
+        {
+            _effect.effect.segments = nullptr;
             return err;
+        }
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        // Still buzzing, check again later
+        if (active)
+        {
+            wait = SFE_QWIIC_BUZZER_ACTIVE_POLL_INTERVAL;
+            return ksfTkErrOk;
+        }
+    }
+
+    // The last step has already turned itself off
+    _effect.effect.segments = nullptr;
+    return ksfTkErrOk;
+}
 
-        sftk_delay_ms(10);
+void sfDevBuzzer::armIdleWatch(const uint16_t duration)
+{
+    // Buzzes without a duration never end on their own
+    if (_idleCallback == nullptr || duration == 0)
+    {
+        _idleArmed = false;
+        return;
     }
-    err = off();
-    // Check whether the write was successful
-    if (err != ksfTkErrOk)
-        return err;
-    sftk_delay_ms(laughdelay);
 
-    for (i = 1010; i < 1176; i += laughstep) // 1010, 1176
+    // The buzz has just started, update() knows the time
+    _idleArmed = true;
+    _idleStarted = false;
+    _idleDuration = duration;
+}
+
+sfTkError_t sfDevBuzzer::pollIdle(const uint32_t nowMs)
+{
+    // No need to read ACTIVE before the duration has elapsed
+    if (!_idleStarted)
     {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        _idleStarted = true;
+        _idleDue = nowMs + _idleDuration;
+        _idleInterval = SFE_QWIIC_BUZZER_ACTIVE_POLL_INTERVAL;
+        return ksfTkErrOk;
+    }
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+    if ((int32_t)(nowMs - _idleDue) < 0)
+        return ksfTkErrOk;
 
-        sftk_delay_ms(10);
+    bool active;
+    sfTkError_t err = isActive(active);
+    // Check whether the read was successful, and try again later if not
+    if (err != ksfTkErrOk || active)
+    {
+        _idleDue = nowMs + _idleInterval;
+        if (_idleInterval < SFE_QWIIC_BUZZER_ACTIVE_POLL_MAX)
+            _idleInterval *= 2;
+        return err;
     }
-    return off();
+
+    // The callback may play the next note, which arms the watch again
+    _idleArmed = false;
+    _idleCallback(this, _idleContext);
+    return ksfTkErrOk;
 }
 
-sfTkError_t sfDevBuzzer::soundEffect8(const uint8_t volume)
+sfTkError_t sfDevBuzzer::readRegisters(const uint8_t devReg, uint8_t *data, const size_t length)
 {
+    uint16_t backoff = _retryPolicy.backoffMs;
     sfTkError_t err;
-    int crydelay = 500;
-    int step = 10;
-    uint16_t i;
-
-    for (i = 2000; i > 1429; i -= step) // vary down //2000, 1429
+    for (uint8_t attempt = 1;; attempt++)
     {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        size_t readBytes = 0;
+        err = _theBus->readRegister(devReg, data, length, readBytes);
+        SFE_QWIIC_BUZZER_COUNT_TRANSACTION(readBytes);
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        // A short read is as bad as a failed one
+        if (err == ksfTkErrOk && readBytes != length)
+            err = ksfTkErrFail;
 
-        sftk_delay_ms(10);
-    }
-    err = off();
-    // Check whether the write was successful
-    if (err != ksfTkErrOk)
-        return err;
-    sftk_delay_ms(crydelay);
-
-    for (i = 1667; i > 1250; i -= step) // 1667, 1250
-    {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        if (err == ksfTkErrOk)
+        {
+            _failuresInRow = 0;
+            return ksfTkErrOk;
+        }
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
+        _busStats.errors++;
+        if (_singleAttempt)
             return err;
-
-        sftk_delay_ms(10);
+        if (!retryAfter(attempt, backoff))
+            return busFailed(err);
     }
-    err = off();
-    // Check whether the write was successful
-    if (err != ksfTkErrOk)
-        return err;
-    sftk_delay_ms(crydelay);
+}
 
-    for (i = 1429; i > 1053; i -= step) // 1429, 1053
+sfTkError_t sfDevBuzzer::writeRegisters(const uint8_t devReg, const uint8_t *data, const size_t length)
+{
+    uint16_t backoff = _retryPolicy.backoffMs;
+    sfTkError_t err;
+    for (uint8_t attempt = 1;; attempt++)
     {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        err = _theBus->writeRegister(devReg, data, length);
+        SFE_QWIIC_BUZZER_COUNT_TRANSACTION(err == ksfTkErrOk ? length : 0);
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        if (err == ksfTkErrOk)
+        {
+            _failuresInRow = 0;
+            return ksfTkErrOk;
+        }
 
-        sftk_delay_ms(10);
+        _busStats.errors++;
+        if (_singleAttempt)
+            return err;
+        if (!retryAfter(attempt, backoff))
+            return busFailed(err);
     }
-    return off();
 }
 
-sfTkError_t sfDevBuzzer::soundEffect9(const uint8_t volume)
+bool sfDevBuzzer::retryAfter(const uint8_t attempt, uint16_t &backoff)
 {
-    sfTkError_t err;
-    int crydelay = 200;
-    int step = 20;
-    uint16_t i;
+    if (attempt > _retryPolicy.retries)
+        return false;
 
-    for (i = 2000; i > 1429; i -= step) // vary down //2000, 1429
+    _busStats.retries++;
+    if (backoff > 0)
     {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+        delayMs(backoff);
+        backoff = backoff > _retryPolicy.backoffMaxMs / 2 ? _retryPolicy.backoffMaxMs : backoff * 2;
+    }
+    return true;
+}
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+sfTkError_t sfDevBuzzer::busFailed(const sfTkError_t err)
+{
+    _busStats.failures++;
+    if (_failuresInRow < 0xFF)
+        _failuresInRow++;
 
-        sftk_delay_ms(10);
-    }
-    err = off();
-    // Check whether the write was successful
-    if (err != ksfTkErrOk)
+    if (_rebeginning || _retryPolicy.rebeginAfter == 0 || _failuresInRow < _retryPolicy.rebeginAfter)
         return err;
 
-    sftk_delay_ms(crydelay);
+    // The buzzer may have reset or been reconnected, start over with it. A
+    // save queued by saveSettings(), and what was last saved, still stand.
+    _rebeginning = true;
+    _busStats.rebegins++;
+    _failuresInRow = 0;
+    invalidateCache();
+    probe();
+    _rebeginning = false;
 
-    for (i = 1667; i > 1250; i -= step) // 1667, 1250
-    {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+    return err;
+}
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+void sfDevBuzzer::abortSoundEffect()
+{
+    _busStats.aborts++;
 
-        sftk_delay_ms(10);
-    }
-    err = off();
-    // Check whether the write was successful
-    if (err != ksfTkErrOk)
-        return err;
-    sftk_delay_ms(crydelay);
+    // Best effort, whatever the bus does. The cache forgets ACTIVE, so that the
+    // next off() writes it even if the value cached is 0.
+    _registerCache.invalidateActive();
+    stopSoundEffect();
+}
 
-    for (i = 1429; i > 1053; i -= step) // 1429, 1053
-    {
-        err = configureBuzzer(i, 0, volume);
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+uint32_t sfDevBuzzer::ticksMs()
+{
+    if (_clock != nullptr)
+        return _clock->ticksMs();
 
-        err = on();
-        // Check whether the write was successful
-        if (err != ksfTkErrOk)
-            return err;
+    return sftk_ticks_ms();
+}
+
+void sfDevBuzzer::delayMs(const uint32_t ms)
+{
+    if (_clock != nullptr)
+        _clock->delayMs(ms);
+    else
+        sftk_delay_ms(ms);
+}
+
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+sfDevBuzzer::sfDevBuzzerApiScope::sfDevBuzzerApiScope(sfDevBuzzer *buzzer, const sfDevBuzzerApi api)
+    : _buzzer{nullptr}, _startUs{0}
+{
+    // Calls made within another counted call are counted with it
+    if (buzzer->_instrumentApi != kSfeQwiicBuzzerApiCount)
+        return;
+
+    _buzzer = buzzer;
+    _buzzer->_instrumentApi = api;
+    if (_buzzer->_instrumentClockUs != nullptr)
+        _startUs = _buzzer->_instrumentClockUs();
+}
+
+sfDevBuzzer::sfDevBuzzerApiScope::~sfDevBuzzerApiScope()
+{
+    if (_buzzer == nullptr)
+        return;
+
+    sfDevBuzzerApiStats &stats = _buzzer->_instrumentation.api[_buzzer->_instrumentApi];
+    _buzzer->_instrumentApi = kSfeQwiicBuzzerApiCount;
+    stats.calls++;
+
+    if (_buzzer->_instrumentClockUs == nullptr)
+        return;
+
+    uint32_t elapsedUs = _buzzer->_instrumentClockUs() - _startUs;
+    if (elapsedUs > stats.maxUs)
+        stats.maxUs = elapsedUs;
+
+    // Find the first bucket the call is shorter than
+    uint8_t bucket = 0;
+    while (bucket < SFE_QWIIC_BUZZER_LATENCY_BUCKETS - 1 &&
+           elapsedUs >= ((uint32_t)SFE_QWIIC_BUZZER_LATENCY_BUCKET_US << bucket))
+        bucket++;
+    stats.latency[bucket]++;
+}
+
+void sfDevBuzzer::countTransaction(const size_t bytes)
+{
+    sfDevBuzzerApi api = _instrumentApi == kSfeQwiicBuzzerApiCount ? kSfeQwiicBuzzerApiOther : _instrumentApi;
+    _instrumentation.api[api].transactions++;
+    _instrumentation.api[api].bytes += bytes;
+}
+#endif
 
-        sftk_delay_ms(10);
-    }
-    return off();
-}
\ No newline at end of file
@@ -19,8 +19,13 @@
 
 #pragma once
 
+#include "sfDevBuzzerEffects.h"
+#include "sfDevBuzzerInstrumentation.h"
 #include "sfDevBuzzerPitches.h"
+#include "sfDevBuzzerRegisterCache.h"
 #include "sfDevBuzzerRegisters.h"
+#include "sfDevBuzzerTiming.h"
+#include "sfDevBuzzerTuning.h"
 
 #include <stdint.h>
 
@@ -38,12 +43,128 @@
 #define SFE_QWIIC_BUZZER_VOLUME_LOW 2
 #define SFE_QWIIC_BUZZER_VOLUME_MID 3
 #define SFE_QWIIC_BUZZER_VOLUME_MAX 4
+#define SFE_QWIIC_BUZZER_USER_EFFECT_COUNT 4
+
+// Extra time (ms) a device-timed sound effect step keeps sounding after its
+// dwell, so that a late update() doesn't leave a gap in a sweep
+#define SFE_QWIIC_BUZZER_EFFECT_SLACK 5
+
+// Default number of tone writes per second glides may use
+#define SFE_QWIIC_BUZZER_WRITE_BUDGET 200
+
+// Interval (ms) between reads of ACTIVE while waiting for a sound effect to end
+#define SFE_QWIIC_BUZZER_ACTIVE_POLL_INTERVAL 2
+
+// Longest interval (ms) between reads of ACTIVE while waiting for the buzzer to
+// go idle; the interval doubles from SFE_QWIIC_BUZZER_ACTIVE_POLL_INTERVAL
+#define SFE_QWIIC_BUZZER_ACTIVE_POLL_MAX 32
+
+// Number of registers in the register map, kSfeQwiicBuzzerRegId to
+// kSfeQwiicBuzzerRegI2cAddress
+#define SFE_QWIIC_BUZZER_REGISTER_COUNT 11
+
+// Number of registers committed to EEPROM by saveSettings(), besides the I2C
+// address: kSfeQwiicBuzzerRegToneFrequencyMsb to kSfeQwiicBuzzerRegDurationLsb
+#define SFE_QWIIC_BUZZER_SAVED_REGISTERS 5
+
+// Default retry policy for register reads and writes: number of retries, first
+// backoff (ms, doubles after each retry) and longest backoff (ms)
+#define SFE_QWIIC_BUZZER_RETRY_COUNT 2
+#define SFE_QWIIC_BUZZER_RETRY_BACKOFF 1
+#define SFE_QWIIC_BUZZER_RETRY_BACKOFF_MAX 8
+
+// Number of failed reads or writes in a row, retries included, after which the
+// buzzer is begun again (0 = never)
+#define SFE_QWIIC_BUZZER_REBEGIN_AFTER 3
+
+/// @brief Contents of the register map of the Qwiic Buzzer
+struct sfDevBuzzerConfig
+{
+    uint8_t deviceId;       ///< Device ID, read only
+    uint8_t firmwareMinor;  ///< Firmware version minor, read only
+    uint8_t firmwareMajor;  ///< Firmware version major, read only
+    uint16_t toneFrequency; ///< Frequency in Hz of buzzer tone
+    uint8_t volume;         ///< Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    uint16_t duration;      ///< Duration in milliseconds (0 = forever)
+    bool active;            ///< True while buzzing
+    uint8_t address;        ///< I2C address, 7-bit unshifted
+};
+
+/// @brief Values of the registers kSfeQwiicBuzzerRegToneFrequencyMsb to
+/// kSfeQwiicBuzzerRegActive for one note, ready to be written by play()
+struct sfDevBuzzerNote
+{
+    uint8_t registers[SFE_QWIIC_BUZZER_CACHED_REGISTERS]; ///< Tone MSB/LSB, volume, duration MSB/LSB, ACTIVE
+};
+
+/// @brief How register reads and writes are retried when the bus fails
+struct sfDevBuzzerRetryPolicy
+{
+    uint8_t retries;       ///< Retries after the first attempt, 0 to fail right away
+    uint16_t backoffMs;    ///< Wait before the first retry, doubling after each one
+    uint16_t backoffMaxMs; ///< Longest wait between two retries
+    uint8_t rebeginAfter;  ///< Failed reads or writes in a row before begin() runs again, 0 for never
+};
+
+/// @brief Bus error counters
+struct sfDevBuzzerBusStats
+{
+    uint32_t errors;   ///< Failed bus transactions, retries included
+    uint32_t retries;  ///< Transactions retried
+    uint32_t failures; ///< Reads or writes that failed after all their retries
+    uint32_t rebegins; ///< Times begin() ran again after repeated failures
+    uint32_t aborts;   ///< Sound effects aborted because of a failure
+};
+
+/// @brief How the steps of sound effects are timed
+enum sfDevBuzzerEffectTiming : uint8_t
+{
+    kSfeQwiicBuzzerTimingHost = 0,         ///< Steps buzz until the host turns them off
+    kSfeQwiicBuzzerTimingDevice = 1,       ///< Steps are given a duration, and the buzzer turns itself off
+    kSfeQwiicBuzzerTimingDevicePolled = 2, ///< As kSfeQwiicBuzzerTimingDevice, and the effect only ends
+                                           ///< once ACTIVE reads back 0
+};
+
+/// @brief Playback position of the non-blocking sound effect player
+struct sfDevBuzzerEffectState
+{
+    sfDevBuzzerEffect effect;        ///< Effect being played, no segments when idle
+    uint8_t segment;                 ///< Current segment
+    uint8_t pass;                    ///< Current repetition
+    uint16_t frequency;              ///< Last frequency of the current sweep, or steps played of the
+                                     ///< current glide
+    bool started;                    ///< A step of the current segment has been played
+    uint8_t volume;                  ///< Volume of the effect
+    bool pending;                    ///< The first step has not been played yet
+    uint32_t due;                    ///< Time (ms) at which the next step is due, counted from the time
+                                     ///< the current one was due
+};
+
+class sfDevBuzzer;
+
+/// @brief Called when a buzz with a duration has ended
+/// @param buzzer The buzzer that went idle
+/// @param context Pointer given to setIdleCallback()
+typedef void (*sfDevBuzzerIdleCallback)(sfDevBuzzer *buzzer, void *context);
 
 class sfDevBuzzer
 {
   public:
     /// @brief Default constructor
-    sfDevBuzzer() : _theBus{nullptr}
+    sfDevBuzzer()
+        : _theBus{nullptr}, _registerCache{}, _effect{{nullptr, 0, 0}, 0, 0, 0, false, 0, false, 0},
+          _userEffects{}, _effectTiming{kSfeQwiicBuzzerTimingHost}, _effectSlack{SFE_QWIIC_BUZZER_EFFECT_SLACK},
+          _writeBudget{SFE_QWIIC_BUZZER_WRITE_BUDGET}, _timingStats{0, 0, 0, 0, 0, 0, 0}, _clock{nullptr},
+          _idleCallback{nullptr}, _idleContext{nullptr}, _idleArmed{false}, _idleStarted{false}, _idleDuration{0},
+          _idleInterval{0}, _idleDue{0}, _savedSettings{}, _savedAddress{0}, _savedValid{false}, _savePending{false},
+          _saveTimed{false}, _saveInterval{0}, _lastSave{0}, _savesAvoided{0},
+          _retryPolicy{SFE_QWIIC_BUZZER_RETRY_COUNT, SFE_QWIIC_BUZZER_RETRY_BACKOFF, SFE_QWIIC_BUZZER_RETRY_BACKOFF_MAX,
+                       SFE_QWIIC_BUZZER_REBEGIN_AFTER},
+          _busStats{0, 0, 0, 0, 0}, _failuresInRow{0}, _rebeginning{false}, _singleAttempt{false}
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+          ,
+          _instrumentation{}, _instrumentApi{kSfeQwiicBuzzerApiCount}, _instrumentClockUs{nullptr}
+#endif
     {
     }
 
@@ -52,6 +173,14 @@ class sfDevBuzzer
     /// @return 0 for succuss, negative for errors, positive for warnings
     sfTkError_t begin(sfTkII2C *theBus = nullptr);
 
+    /// @brief Begins the Qwiic Buzzer without checking that it answers, for a
+    /// buzzer already known to be there (e.g. found by a bus scan). The state
+    /// of the driver is reset the same way as by begin(), but nothing is
+    /// sent on the bus.
+    /// @param theBus I2C bus to use for communication
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t beginWithoutProbe(sfTkII2C *theBus);
+
     /// @brief Checks if the Qwiic Buzzer is connected
     /// @return 0 for succuss, negative for errors, positive for warnings
     sfTkError_t isConnected();
@@ -71,6 +200,23 @@ class sfDevBuzzer
     /// @return 1 for succuss, 0 error
     bool firmwareVersionMinor(uint8_t &versionMinor);
 
+    /// @brief Reads the whole register map in a single I2C transaction. The
+    /// register cache is updated with the values read, so that following
+    /// writes only send what differs from them.
+    /// @param config Variable where the read results will be stored
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t readConfig(sfDevBuzzerConfig &config);
+
+    /// @brief Writes a configuration, skipping the fields that already have
+    /// the right value (according to the register cache, see readConfig()).
+    /// The tone, volume, duration and active fields take a single I2C
+    /// transaction at most, and changing the address one more. The read only
+    /// fields are ignored. Use saveSettings() to keep the configuration after
+    /// a power cycle.
+    /// @param config The configuration
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t writeConfig(const sfDevBuzzerConfig &config);
+
     /// @brief Configures the Qwiic Buzzer without causing the buzzer to buzz.
     /// This allows configuration in silence (before you may want to buzz).
     /// It is also useful in combination with saveSettings(), and then later
@@ -84,18 +230,105 @@ class sfDevBuzzer
     sfTkError_t configureBuzzer(const uint16_t toneFrequency = SFE_QWIIC_BUZZER_RESONANT_FREQUENCY,
                                 const uint16_t duration = 0, const uint8_t volume = 4);
 
-    /// @brief Turns on buzzer
+    /// @brief Configures the Qwiic Buzzer and turns it on, in a single I2C
+    /// transaction. This is the same as configureBuzzer() followed by on(),
+    /// with half the bus overhead.
+    /// @param toneFrequency Frequency in Hz of buzzer tone
+    /// @param duration Duration in milliseconds (0 = forever)
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t play(const uint16_t toneFrequency = SFE_QWIIC_BUZZER_RESONANT_FREQUENCY, const uint16_t duration = 0,
+                     const uint8_t volume = 4);
+
+    /// @brief Plays a note prepared with makeNote(), in a single I2C transaction
+    /// @param note The note
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t play(const sfDevBuzzerNote &note);
+
+    /// @brief Prepares the register values of a note, so that it can be played
+    /// later without any further computation
+    /// @param note Where the register values are stored
+    /// @param toneFrequency Frequency in Hz of buzzer tone
+    /// @param duration Duration in milliseconds (0 = forever)
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    static void makeNote(sfDevBuzzerNote &note, const uint16_t toneFrequency, const uint16_t duration = 0,
+                         const uint8_t volume = 4);
+
+    /// @brief Prepares the register values of a note from a pitch table, see
+    /// sfDevBuzzerReadPitch(). The tone bytes are copied as they are.
+    /// @param note Where the register values are stored
+    /// @param pitch Frequency of the buzzer tone, already split into bytes
+    /// @param duration Duration in milliseconds (0 = forever)
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    static void makeNote(sfDevBuzzerNote &note, const sfDevBuzzerPitch &pitch, const uint16_t duration = 0,
+                         const uint8_t volume = 4);
+
+    /// @brief Turns on buzzer. Nothing is written if the buzzer is already on
+    /// with no duration set.
     /// @return 0 for succuss, negative for errors, positive for warnings
     sfTkError_t on();
 
+    /// @brief Turns on buzzer with a single attempt: no retries, no backoff, and
+    /// a failure does not count towards begin() running again. Used for bursts
+    /// of writes, where one failing buzzer must not hold up the others (see
+    /// sfDevBuzzerGroup); call on() afterwards if it failed.
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t tryOn();
+
     /// @brief Turns off buzzer
     /// @return 0 for succuss, negative for errors, positive for warnings
     sfTkError_t off();
 
-    /// @brief Stores settings to EEPROM
+    /// @brief Reads whether the buzzer is buzzing. A buzz with a duration
+    /// reads back 0 once the buzzer has turned itself off.
+    /// @param active Variable where the read results will be stored
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t isActive(bool &active);
+
+    /// @brief Sets a function to call when a buzz with a duration ends. Every
+    /// play() or on() with a duration arms it; update() then waits until the
+    /// duration has elapsed, and reads ACTIVE until the buzzer reports it is
+    /// off, doubling the interval between reads from
+    /// SFE_QWIIC_BUZZER_ACTIVE_POLL_INTERVAL to SFE_QWIIC_BUZZER_ACTIVE_POLL_MAX.
+    /// The callback may play the next note, which arms it again.
+    /// @param callback Function to call, nullptr to stop watching
+    /// @param context Pointer passed to the callback
+    void setIdleCallback(sfDevBuzzerIdleCallback callback, void *context = nullptr);
+
+    /// @brief Forgets the cached register values, so the next configureBuzzer(),
+    /// on() and off() write all of their registers. Use this if the buzzer may
+    /// have been changed by something other than this library (e.g. the
+    /// TRIGGER pin, or a reset of the buzzer).
+    void invalidateCache();
+
+    /// @brief Stores settings to EEPROM. The save is skipped when the tone,
+    /// volume, duration and address are the same as at the last save by this
+    /// library. With a save interval set, the save is only queued, and
+    /// update() commits it once the interval since the last commit has passed.
     /// @return 0 for succuss, negative for errors, positive for warnings
     sfTkError_t saveSettings();
 
+    /// @brief Sets the shortest time between two EEPROM commits. Calls to
+    /// saveSettings() within the interval are coalesced into a single commit,
+    /// made by update().
+    /// @param intervalMs Interval in milliseconds, 0 to commit right away
+    void setSaveInterval(const uint32_t intervalMs);
+
+    /// @brief Commits a save queued by saveSettings() right away, e.g. before
+    /// powering down. Nothing is written if there is no queued save.
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t flushSettings();
+
+    /// @brief Checks if the settings differ from the ones last saved. Settings
+    /// never saved by this library, or not known, count as different.
+    /// @return True if saveSettings() would commit to EEPROM
+    bool settingsDirty();
+
+    /// @brief Gets the number of saveSettings() calls that did not cause an
+    /// EEPROM commit, because nothing changed or they were coalesced
+    /// @return Number of commits avoided
+    uint32_t savesAvoided();
+
     /// @brief Changes the I2C address of the Qwiic Buzzer
     /// @param address New address, must be in the range 0x08 to 0x77
     /// @return 0 for succuss, negative for errors, positive for warnings
@@ -105,93 +338,315 @@ class sfDevBuzzer
     /// @return The current I2C address, 7-bit unshifted
     uint8_t address();
 
-    /// @brief Plays one of the sound effects included in this library
+    /// @brief Sets how register reads and writes are retried when the bus
+    /// fails. Retries wait on the timing clock (see setTimingClock()), so they
+    /// block. The default is SFE_QWIIC_BUZZER_RETRY_COUNT retries, with a
+    /// backoff from SFE_QWIIC_BUZZER_RETRY_BACKOFF to
+    /// SFE_QWIIC_BUZZER_RETRY_BACKOFF_MAX ms, and begin() again after
+    /// SFE_QWIIC_BUZZER_REBEGIN_AFTER failures in a row. Unlike a call to
+    /// begin(), that keeps a save queued by saveSettings().
+    /// @param policy The retry policy
+    void setRetryPolicy(const sfDevBuzzerRetryPolicy &policy);
+
+    /// @brief Gets the bus error counters
+    /// @param stats Variable where the counters will be stored
+    void busStats(sfDevBuzzerBusStats &stats);
+
+    /// @brief Sets all bus error counters to 0
+    void resetBusStats();
+
+    /// @brief Sets the clock used to time calls for the latency histograms.
+    /// Without a clock, calls, transactions and bytes are still counted. Does
+    /// nothing unless SFE_QWIIC_BUZZER_INSTRUMENTATION is 1.
+    /// @param clockUs Function returning the time in microseconds (e.g. micros())
+    void setInstrumentationClock(uint32_t (*clockUs)(void));
+
+    /// @brief Gets a copy of the instrumentation counters. All 0 unless
+    /// SFE_QWIIC_BUZZER_INSTRUMENTATION is 1.
+    /// @param snapshot Variable where the counters will be stored
+    void instrumentation(sfDevBuzzerInstrumentation &snapshot);
+
+    /// @brief Sets all instrumentation counters to 0
+    void resetInstrumentation();
+
+    /// @brief Plays one of the sound effects included in this library, or one
+    /// registered with registerSoundEffect(). Blocks until the effect is done.
+    /// Any effect started with startSoundEffect() is replaced.
     /// @param soundEffectNumber The sound effect you with to play
     /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
     /// @return 1 for succuss, 0 error
     bool playSoundEffect(const uint8_t soundEffectNumber, const uint8_t volume);
 
-  private:
-    /// @brief Plays sound effect 0 (aka "Siren")
-    /// Intended to sound like a siren, starting at a low frequency, and then
-    /// increasing rapidly up and then back down. This sound effect does a
-    /// single "up and down" cycle.
+    /// @brief Plays a sound effect descriptor. Blocks until the effect is done.
+    /// @param effect The sound effect, stored with SFE_QWIIC_BUZZER_PROGMEM
     /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
     /// @return 0 for succuss, negative for errors, positive for warnings
-    sfTkError_t soundEffect0(const uint8_t volume);
+    sfTkError_t playSoundEffect(const sfDevBuzzerEffect &effect, const uint8_t volume);
 
-    /// @brief Plays sound effect 1 (aka "3 Fast Sirens")
-    /// Intended to sound like a siren, starting at a low frequency, and then
-    /// increasing rapidly up and then back down. This sound effect does this
-    /// cycle of "up and down" three times rapidly.
+    /// @brief Starts one of the sound effects included in this library, or one
+    /// registered with registerSoundEffect(), without blocking. The effect is
+    /// played by calling update() from your loop. Any effect already playing
+    /// is replaced.
+    /// @param soundEffectNumber The sound effect you with to play
     /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
-    /// @return 0 for succuss, negative for errors, positive for warnings
-    sfTkError_t soundEffect1(const uint8_t volume);
+    /// @return 1 for succuss, 0 error
+    bool startSoundEffect(const uint8_t soundEffectNumber, const uint8_t volume);
 
-    /// @brief Plays sound effect 2 (aka "robot saying 'Yes'")
-    /// Intended to sound like a robot saying the word "yes".
-    /// It starts at a low frequency and quickly ramps up to a high frequency,
-    /// then stops. This can be interpreted by most to be an affirmative
-    /// sound to any question you may ask your buzzing robot.
+    /// @brief Starts a sound effect descriptor without blocking
+    /// @param effect The sound effect, stored with SFE_QWIIC_BUZZER_PROGMEM
     /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    void startSoundEffect(const sfDevBuzzerEffect &effect, const uint8_t volume);
+
+    /// @brief Advances the non-blocking sound effect player, checks for the
+    /// end of a buzz if an idle callback is set, and commits a queued save once
+    /// the save interval allows it. Only accesses the buzzer when the next step
+    /// of the effect is due, when ACTIVE needs to be read or when a save is
+    /// committed, otherwise returns immediately.
+    /// @param nowMs Current time in milliseconds (e.g. millis())
     /// @return 0 for succuss, negative for errors, positive for warnings
-    sfTkError_t soundEffect2(const uint8_t volume);
+    sfTkError_t update(const uint32_t nowMs);
 
-    /// @brief Plays sound effect 3 (aka "robot yelling 'YES!'" - faster)
-    /// Intended to sound like a robot saying the word "yes".
-    /// It starts at a low frequency and quickly ramps up to a high frequency,
-    /// then stops. This can be interpreted by most to be an affirmative
-    /// sound to any question you may ask your buzzing robot. As this sound
-    /// is done more quickly, it can add enthusiasm to the buzzing sound.
-    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @brief Checks if a sound effect started with startSoundEffect() is playing
+    /// @return True if an effect is playing, false otherwise
+    bool isPlaying();
+
+    /// @brief Stops the sound effect started with startSoundEffect(), and turns
+    /// off the buzzer
     /// @return 0 for succuss, negative for errors, positive for warnings
-    sfTkError_t soundEffect3(const uint8_t volume);
+    sfTkError_t stopSoundEffect();
+
+    /// @brief Sets how the steps of sound effects are timed. By default
+    /// (kSfeQwiicBuzzerTimingHost), each step buzzes until the next one, and
+    /// rests and the end of the effect turn the buzzer off.
+    ///
+    /// With kSfeQwiicBuzzerTimingDevice, each step is written once with its
+    /// duration, so the buzzer turns itself off: rests and the end of the
+    /// effect need no write, and a late or missed update() can't leave the
+    /// buzzer on. Steps within a sweep last slackMs longer than their dwell,
+    /// so a slightly late update() doesn't leave a gap. With
+    /// kSfeQwiicBuzzerTimingDevicePolled, the effect is also only reported as
+    /// done once ACTIVE reads back 0.
+    /// @param timing How the steps are timed
+    /// @param slackMs Extra duration of the steps within a sweep, in milliseconds
+    void setEffectTiming(const sfDevBuzzerEffectTiming timing,
+                         const uint16_t slackMs = SFE_QWIIC_BUZZER_EFFECT_SLACK);
 
-    /// @brief Plays sound effect 4 (aka "robot saying 'No'")
-    /// Intended to sound like a robot saying the word "no".
-    /// It starts at a high frequency and quickly ramps down to a low frequency,
-    /// then stops. This can be interpreted by most to be an negative
-    /// sound to any question you may ask your buzzing robot.
+    /// @brief Glides from one frequency to another. Blocks until the glide is
+    /// done, then turns the buzzer off. The glide has as many steps as the
+    /// write budget allows (see setWriteBudget()), so it is as smooth as the
+    /// bus allows.
+    /// @param fromHz First frequency in Hz
+    /// @param toHz Last frequency in Hz
+    /// @param durationMs Length of the glide in milliseconds
+    /// @param curve Shape of the glide
     /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
     /// @return 0 for succuss, negative for errors, positive for warnings
-    sfTkError_t soundEffect4(const uint8_t volume);
+    sfTkError_t glide(const uint16_t fromHz, const uint16_t toHz, const uint16_t durationMs,
+                      const sfDevBuzzerGlideCurve curve = kSfeQwiicBuzzerGlideExponential,
+                      const uint8_t volume = SFE_QWIIC_BUZZER_VOLUME_MAX);
+
+    /// @brief Sets how many tone writes per second glides may use, both with
+    /// glide() and in sound effects (SFE_QWIIC_BUZZER_GLIDE). Each write of a
+    /// new tone takes about 0.5ms at 100KHz, 0.15ms at 400KHz.
+    /// @param writesPerSecond Write budget, SFE_QWIIC_BUZZER_WRITE_BUDGET by default
+    void setWriteBudget(const uint16_t writesPerSecond);
+
+    /// @brief Gets how well the steps of sound effects and glides kept to
+    /// their schedule. Each step is due a fixed time after the previous one
+    /// was due, so the time spent on the bus doesn't add up over an effect.
+    /// @param stats Variable where the statistics will be stored
+    void timingStats(sfDevBuzzerTimingStats &stats);
+
+    /// @brief Sets all timing statistics to 0
+    void resetTimingStats();
+
+    /// @brief Sets the clock used by the blocking calls (playSoundEffect(),
+    /// glide() and the waits between retries) to read the time and sleep.
+    /// Calls that take the time as a parameter, like update(), are not
+    /// affected: give them the time of the same clock.
+    /// @param clock The clock, nullptr for sftk_ticks_ms() and sftk_delay_ms()
+    void setTimingClock(sfDevBuzzerClock *clock);
+
+    /// @brief Gets the playback position of the sound effect started with
+    /// startSoundEffect(), e.g. to resume it later
+    /// @param state Where the position is copied
+    void soundEffectState(sfDevBuzzerEffectState &state);
+
+    /// @brief Continues a sound effect from a position saved with
+    /// soundEffectState(), without blocking. Its next step is played on the
+    /// next call to update(). Any effect already playing is replaced.
+    /// @param state The saved position
+    void resumeSoundEffect(const sfDevBuzzerEffectState &state);
+
+    /// @brief Registers a user-defined sound effect, so it can be played by
+    /// number with playSoundEffect() and startSoundEffect()
+    /// @param soundEffectNumber Number of the effect, from
+    /// SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT (10) to 10 +
+    /// SFE_QWIIC_BUZZER_USER_EFFECT_COUNT - 1
+    /// @param effect The sound effect, stored with SFE_QWIIC_BUZZER_PROGMEM.
+    /// nullptr removes the effect.
+    /// @return 1 for succuss, 0 error
+    bool registerSoundEffect(const uint8_t soundEffectNumber, const sfDevBuzzerEffect *effect);
+
+  private:
+    // The register cache writes through writeRegisters()
+    friend class sfDevBuzzerRegisterCache;
+
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+    /// @brief Counts a call to a group of methods, and its latency, from its
+    /// construction to its destruction. Does nothing when constructed within
+    /// another scope.
+    class sfDevBuzzerApiScope
+    {
+      public:
+        sfDevBuzzerApiScope(sfDevBuzzer *buzzer, const sfDevBuzzerApi api);
+        ~sfDevBuzzerApiScope();
+
+      private:
+        sfDevBuzzer *_buzzer; // nullptr when an outer scope counts the call
+        uint32_t _startUs;
+    };
 
-    /// @brief Plays sound effect 5 (aka "robot yelling 'NO!'" - faster)
-    /// Intended to sound like a robot saying the word "no".
-    /// It starts at a high frequency and quickly ramps down to a low frequency,
-    /// then stops. This can be interpreted by most to be an negative
-    /// sound to any question you may ask your buzzing robot. As this sound
-    /// is done more quickly, it can add enthusiasm to the buzzing sound.
+    /// @brief Counts a bus transaction for the group of methods being called
+    /// @param bytes Number of data bytes written or read
+    void countTransaction(const size_t bytes);
+#endif
+
+    /// @brief Fills in the values of the configuration registers, starting at
+    /// kSfeQwiicBuzzerRegToneFrequencyMsb
+    /// @param data Buffer of at least 5 bytes
+    /// @param toneFrequency Frequency in Hz of buzzer tone
+    /// @param duration Duration in milliseconds (0 = forever)
     /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    static void fillConfiguration(uint8_t *data, const uint16_t toneFrequency, const uint16_t duration,
+                                  const uint8_t volume);
+
+    /// @brief Finds the descriptor of a sound effect number
+    /// @param soundEffectNumber The sound effect number
+    /// @return The descriptor, nullptr if there is no such effect
+    const sfDevBuzzerEffect *findSoundEffect(const uint8_t soundEffectNumber);
+
+    /// @brief Plays the next step of the current sound effect
+    /// @param wait Time in milliseconds until the following step is due
+    /// @param played False if there was no step left, and the end of the
+    /// effect was checked instead
     /// @return 0 for succuss, negative for errors, positive for warnings
-    sfTkError_t soundEffect5(const uint8_t volume);
+    sfTkError_t stepSoundEffect(uint32_t &wait, bool &played);
 
-    /// @brief Plays sound effect 6 (aka "Laughing Robot")
-    /// Intended to sound like your robot is laughing at you.
-    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @brief Schedules the step after the one just played, from the time the
+    /// played one was due, and counts it in the timing statistics
+    /// @param nowMs Time the step was played
+    /// @param wait Time in milliseconds from the played step to the next one
+    /// @param played False if the end of the effect was checked instead of a
+    /// step, which is not counted
+    void scheduleSoundEffect(const uint32_t nowMs, const uint32_t wait, const bool played);
+
+    /// @brief Starts watching for the end of a buzz, for the idle callback
+    /// @param duration Duration of the buzz in milliseconds
+    void armIdleWatch(const uint16_t duration);
+
+    /// @brief Reads ACTIVE if the watched buzz should be over, and calls the
+    /// idle callback once it is
+    /// @param nowMs Current time in milliseconds
     /// @return 0 for succuss, negative for errors, positive for warnings
-    sfTkError_t soundEffect6(const uint8_t volume);
+    sfTkError_t pollIdle(const uint32_t nowMs);
 
-    /// @brief Plays sound effect 7 (aka "Laughing Robot Faster")
-    /// Intended to sound like your robot is laughing at you. As this sound
-    /// is done more quickly, it can add enthusiasm to the buzzing sound.
-    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @brief Ends the current sound effect, depending on how it is timed
+    /// @param wait Time in milliseconds until the end should be checked again
     /// @return 0 for succuss, negative for errors, positive for warnings
-    sfTkError_t soundEffect7(const uint8_t volume);
+    sfTkError_t finishSoundEffect(uint32_t &wait);
 
-    /// @brief Plays sound effect 8 (aka "Crying Robot")
-    /// Intended to sound like a robot is crying and sad.
-    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @brief Commits the settings to EEPROM if they changed, and remembers them
     /// @return 0 for succuss, negative for errors, positive for warnings
-    sfTkError_t soundEffect8(const uint8_t volume);
+    sfTkError_t commitSettings();
 
-    /// @brief Plays sound effect 9 (aka "Crying Robot Faster")
-    /// Intended to sound like a robot is crying and sad. As this sound
-    /// is done more quickly, it can add enthusiasm to the buzzing sound.
-    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @brief Reads registers, retrying according to the retry policy
+    /// @param devReg First register
+    /// @param data Buffer for the values
+    /// @param length Number of registers
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t readRegisters(const uint8_t devReg, uint8_t *data, const size_t length);
+
+    /// @brief Writes registers, retrying according to the retry policy
+    /// @param devReg First register
+    /// @param data Values of the registers
+    /// @param length Number of registers
     /// @return 0 for succuss, negative for errors, positive for warnings
-    sfTkError_t soundEffect9(const uint8_t volume);
+    sfTkError_t writeRegisters(const uint8_t devReg, const uint8_t *data, const size_t length);
+
+    /// @brief Waits before the next retry
+    /// @param attempt Number of attempts made so far
+    /// @param backoff Wait in milliseconds, doubled for the next retry
+    /// @return True if the transaction should be retried
+    bool retryAfter(const uint8_t attempt, uint16_t &backoff);
+
+    /// @brief Checks that a Qwiic Buzzer answers on the bus, and that its ID
+    /// matches
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t probe();
+
+    /// @brief Counts a read or write that failed after all its retries, and
+    /// begins the buzzer again after too many in a row, keeping the saves
+    /// queued
+    /// @param err The error of the last attempt
+    /// @return err
+    sfTkError_t busFailed(const sfTkError_t err);
+
+    /// @brief Ends the current sound effect after a failure, turning the buzzer
+    /// off if the bus allows it
+    void abortSoundEffect();
+
+    /// @brief Gets the current time from the clock
+    /// @return Time in milliseconds
+    uint32_t ticksMs();
+
+    /// @brief Waits on the clock
+    /// @param ms Number of milliseconds
+    void delayMs(const uint32_t ms);
 
   protected:
     sfTkII2C *_theBus;
+
+    // Last values written to the tone, volume, duration and ACTIVE registers
+    sfDevBuzzerRegisterCache _registerCache;
+
+    sfDevBuzzerEffectState _effect;
+    const sfDevBuzzerEffect *_userEffects[SFE_QWIIC_BUZZER_USER_EFFECT_COUNT];
+    sfDevBuzzerEffectTiming _effectTiming;
+    uint16_t _effectSlack;
+    uint16_t _writeBudget;
+    sfDevBuzzerTimingStats _timingStats;
+    sfDevBuzzerClock *_clock; // nullptr for sftk_ticks_ms() and sftk_delay_ms()
+
+    // Watch for the end of a buzz, for the idle callback
+    sfDevBuzzerIdleCallback _idleCallback;
+    void *_idleContext;
+    bool _idleArmed;        // waiting for the buzzer to go idle
+    bool _idleStarted;      // the end of the buzz has been scheduled by update()
+    uint16_t _idleDuration; // duration of the buzz
+    uint16_t _idleInterval; // time until the next read of ACTIVE
+    uint32_t _idleDue;      // time of the next read of ACTIVE
+
+    // Settings last committed to EEPROM, so that saves that change nothing are skipped
+    uint8_t _savedSettings[SFE_QWIIC_BUZZER_SAVED_REGISTERS];
+    uint8_t _savedAddress;
+    bool _savedValid;        // the saved settings are known
+    bool _savePending;       // saveSettings() was called, update() commits it
+    bool _saveTimed;         // _lastSave holds the time of a commit
+    uint32_t _saveInterval;  // shortest time between two commits
+    uint32_t _lastSave;      // time of the last commit made by update()
+    uint32_t _savesAvoided;
+
+    // Retries of failed register reads and writes
+    sfDevBuzzerRetryPolicy _retryPolicy;
+    sfDevBuzzerBusStats _busStats;
+    uint8_t _failuresInRow;
+    bool _rebeginning; // begin() is running again, failures don't start another one
+    bool _singleAttempt; // tryOn() is running, failures are not retried
+
+#if SFE_QWIIC_BUZZER_INSTRUMENTATION
+    sfDevBuzzerInstrumentation _instrumentation;
+    sfDevBuzzerApi _instrumentApi; // group being called, kSfeQwiicBuzzerApiCount for none
+    uint32_t (*_instrumentClockUs)(void);
+#endif
 };
\ No newline at end of file
@@ -0,0 +1,207 @@
+/**
+ * @file    sfDevBuzzerAlerts.cpp
+ * @brief   Implementation file for the priority alert queue of the Qwiic Buzzer
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file contains the implementation of the sfDevBuzzerAlerts class.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerAlerts.h"
+
+sfDevBuzzerAlerts::sfDevBuzzerAlerts()
+    : _buzzer{nullptr}, _queue{}, _count{0}, _current{}, _playing{false}, _sequence{0}, _drops{0}, _merges{0}
+{
+}
+
+void sfDevBuzzerAlerts::begin(sfDevBuzzer *buzzer)
+{
+    _buzzer = buzzer;
+}
+
+bool sfDevBuzzerAlerts::post(const sfDevBuzzerEffect &effect, const uint8_t priority, const uint8_t volume,
+                             const sfDevBuzzerAlertPolicy policy)
+{
+    // The same alert playing carries on, rather than playing again
+    if (_playing && _current.effect == &effect && _current.state.volume == volume)
+    {
+        merge(_current, priority, policy);
+        return true;
+    }
+
+    // Look for an identical alert, and for the one that would play last
+    uint8_t lowest = 0;
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        sfDevBuzzerAlert &alert = _queue[i];
+        if (alert.effect == &effect && alert.state.volume == volume)
+        {
+            merge(alert, priority, policy);
+            return true;
+        }
+
+        if (outranks(_queue[lowest], alert))
+            lowest = i;
+    }
+
+    uint8_t slot = _count;
+    if (_count >= SFE_QWIIC_BUZZER_ALERT_QUEUE_SIZE)
+    {
+        // Full, one of the alerts has to go
+        _drops++;
+        if (_queue[lowest].priority >= priority)
+            return false;
+        slot = lowest;
+    }
+    else
+        _count++;
+
+    sfDevBuzzerAlert &alert = _queue[slot];
+    alert.effect = &effect;
+    sfDevBuzzerReadProgmem(&alert.state.effect, &effect, sizeof(sfDevBuzzerEffect));
+    alert.state.segment = 0;
+    alert.state.pass = 0;
+    alert.state.frequency = 0;
+    alert.state.started = false;
+    alert.state.volume = volume;
+    alert.state.pending = true;
+    alert.state.due = 0;
+    alert.priority = priority;
+    alert.policy = policy;
+    alert.sequence = _sequence++;
+    return true;
+}
+
+sfTkError_t sfDevBuzzerAlerts::cancel(const sfDevBuzzerEffect &effect)
+{
+    for (uint8_t i = 0; i < _count;)
+    {
+        // Order doesn't matter, fill the gap with the last alert
+        if (_queue[i].effect == &effect)
+            _queue[i] = _queue[--_count];
+        else
+            i++;
+    }
+
+    if (!_playing || _current.effect != &effect)
+        return ksfTkErrOk;
+
+    _playing = false;
+    return _buzzer->stopSoundEffect();
+}
+
+sfTkError_t sfDevBuzzerAlerts::clear()
+{
+    _count = 0;
+    _playing = false;
+    if (_buzzer == nullptr)
+        return ksfTkErrOk;
+
+    return _buzzer->stopSoundEffect();
+}
+
+sfTkError_t sfDevBuzzerAlerts::update(const uint32_t nowMs)
+{
+    if (_buzzer == nullptr)
+        return ksfTkErrOk;
+
+    // The alert playing may have finished since the last update
+    if (_playing && !_buzzer->isPlaying())
+        _playing = false;
+
+    uint8_t index = next();
+    if (index < _count && (!_playing || _queue[index].priority > _current.priority))
+    {
+        sfDevBuzzerAlert alert = _queue[index];
+        _queue[index] = _queue[--_count];
+
+        if (_playing)
+        {
+            // Preempted, there is room in the queue since an alert just left it
+            if (_current.policy == kSfeQwiicBuzzerAlertDrop)
+                _drops++;
+            else
+            {
+                if (_current.policy == kSfeQwiicBuzzerAlertResume)
+                    _buzzer->soundEffectState(_current.state);
+                else
+                {
+                    _current.state.segment = 0;
+                    _current.state.pass = 0;
+                    _current.state.frequency = 0;
+                    _current.state.started = false;
+                }
+                _queue[_count++] = _current;
+            }
+        }
+
+        // No need to turn the buzzer off, the first step of the new alert
+        // overwrites whatever the previous one left
+        _current = alert;
+        _playing = true;
+        _buzzer->resumeSoundEffect(_current.state);
+    }
+
+    sfTkError_t err = _buzzer->update(nowMs);
+
+    if (!_buzzer->isPlaying())
+        _playing = false;
+
+    return err;
+}
+
+bool sfDevBuzzerAlerts::isPlaying()
+{
+    return _playing;
+}
+
+uint8_t sfDevBuzzerAlerts::waiting()
+{
+    return _count;
+}
+
+uint32_t sfDevBuzzerAlerts::drops()
+{
+    return _drops;
+}
+
+uint32_t sfDevBuzzerAlerts::merges()
+{
+    return _merges;
+}
+
+uint8_t sfDevBuzzerAlerts::next()
+{
+    if (_count == 0)
+        return SFE_QWIIC_BUZZER_ALERT_QUEUE_SIZE;
+
+    uint8_t best = 0;
+    for (uint8_t i = 1; i < _count; i++)
+    {
+        if (outranks(_queue[i], _queue[best]))
+            best = i;
+    }
+    return best;
+}
+
+void sfDevBuzzerAlerts::merge(sfDevBuzzerAlert &alert, const uint8_t priority, const sfDevBuzzerAlertPolicy policy)
+{
+    if (priority > alert.priority)
+        alert.priority = priority;
+    alert.policy = policy;
+    _merges++;
+}
+
+bool sfDevBuzzerAlerts::outranks(const sfDevBuzzerAlert &a, const sfDevBuzzerAlert &b)
+{
+    if (a.priority != b.priority)
+        return a.priority > b.priority;
+
+    // First come, first served
+    return (int16_t)(a.sequence - b.sequence) < 0;
+}
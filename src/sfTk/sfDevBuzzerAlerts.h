@@ -0,0 +1,137 @@
+/**
+ * @file    sfDevBuzzerAlerts.h
+ * @brief   Header file for the priority alert queue of the Qwiic Buzzer
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares the sfDevBuzzerAlerts class, which shares one
+ *          buzzer between several parts of a sketch. Each alert is a sound
+ *          effect with a priority: the highest priority alert plays, and
+ *          preempts a lower priority one that is already playing. What happens
+ *          to the preempted alert is set by its policy.
+ *
+ *          Alerts are queued without any I2C traffic, and played without
+ *          blocking by calling update() from your loop. The queue holds
+ *          SFE_QWIIC_BUZZER_ALERT_QUEUE_SIZE alerts and needs no heap.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzer.h"
+
+#define SFE_QWIIC_BUZZER_ALERT_QUEUE_SIZE 8
+
+/// @brief What happens to an alert when a higher priority one preempts it
+enum sfDevBuzzerAlertPolicy : uint8_t
+{
+    kSfeQwiicBuzzerAlertDrop = 0,    ///< The alert is dropped
+    kSfeQwiicBuzzerAlertRestart = 1, ///< The alert is queued again, and plays from the start
+    kSfeQwiicBuzzerAlertResume = 2   ///< The alert is queued again, and continues where it was
+};
+
+/// @brief One alert of the queue
+struct sfDevBuzzerAlert
+{
+    const sfDevBuzzerEffect *effect; ///< The sound effect, also used to find duplicates
+    sfDevBuzzerEffectState state;    ///< How far the sound effect has played
+    uint8_t priority;                ///< Higher priorities play first
+    sfDevBuzzerAlertPolicy policy;   ///< What happens when the alert is preempted
+    uint16_t sequence;               ///< Order of arrival, for alerts of equal priority
+};
+
+class sfDevBuzzerAlerts
+{
+  public:
+    /// @brief Default constructor
+    sfDevBuzzerAlerts();
+
+    /// @brief Sets the buzzer the alerts play on. The buzzer must have been
+    /// begun, and its sound effects should not be started by anything else.
+    /// @param buzzer The buzzer
+    void begin(sfDevBuzzer *buzzer);
+
+    /// @brief Queues an alert. No I2C traffic: the alert starts on a later call
+    /// to update(). If an identical alert (same effect and volume) is already
+    /// waiting or playing, the two are merged: the alert keeps its place in the
+    /// queue (or carries on playing, without starting again), the higher of the
+    /// two priorities, and the policy of the latest post. If the queue is full,
+    /// the lowest priority alert waiting is dropped to make room, or the new
+    /// alert if it has the lowest priority.
+    ///
+    /// Worst case: one pass over the SFE_QWIIC_BUZZER_ALERT_QUEUE_SIZE entries
+    /// of the queue, plus a copy of the effect descriptor.
+    /// @param effect The sound effect, stored with SFE_QWIIC_BUZZER_PROGMEM (e.g.
+    /// kSfeQwiicBuzzerSoundEffects[0])
+    /// @param priority Priority, higher plays first
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @param policy What happens when the alert is preempted
+    /// @return True if the alert is queued or merged, false if it was dropped
+    bool post(const sfDevBuzzerEffect &effect, const uint8_t priority, const uint8_t volume = 4,
+              const sfDevBuzzerAlertPolicy policy = kSfeQwiicBuzzerAlertDrop);
+
+    /// @brief Removes an alert, whether it is waiting or playing
+    /// @param effect The sound effect of the alert
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t cancel(const sfDevBuzzerEffect &effect);
+
+    /// @brief Removes all alerts, and turns off the buzzer
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t clear();
+
+    /// @brief Plays the alerts. Starts the highest priority alert when the
+    /// buzzer is free, or when it outranks the one playing, and advances the
+    /// sound effect of the buzzer.
+    ///
+    /// Worst case: one pass over the queue, plus one step of the sound effect
+    /// (a single I2C write).
+    /// @param nowMs Current time in milliseconds (e.g. millis())
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t update(const uint32_t nowMs);
+
+    /// @brief Checks if an alert is playing
+    /// @return True if an alert is playing, false otherwise
+    bool isPlaying();
+
+    /// @brief Gets the number of alerts waiting to play
+    /// @return Number of alerts, not counting the one playing
+    uint8_t waiting();
+
+    /// @brief Gets the number of alerts dropped, because the queue was full or
+    /// they were preempted with kSfeQwiicBuzzerAlertDrop
+    /// @return Number of dropped alerts
+    uint32_t drops();
+
+    /// @brief Gets the number of alerts merged with an identical one waiting or
+    /// playing
+    /// @return Number of merged alerts
+    uint32_t merges();
+
+  private:
+    /// @brief Finds the alert that should play next
+    /// @return Its index in the queue, or SFE_QWIIC_BUZZER_ALERT_QUEUE_SIZE if
+    /// the queue is empty
+    uint8_t next();
+
+    /// @brief Merges a new post into an identical alert
+    /// @param alert The alert waiting or playing
+    /// @param priority Priority of the new post
+    /// @param policy Policy of the new post
+    void merge(sfDevBuzzerAlert &alert, const uint8_t priority, const sfDevBuzzerAlertPolicy policy);
+
+    /// @brief Checks if an alert should play before another
+    /// @return True if a outranks b
+    static bool outranks(const sfDevBuzzerAlert &a, const sfDevBuzzerAlert &b);
+
+    sfDevBuzzer *_buzzer;
+    sfDevBuzzerAlert _queue[SFE_QWIIC_BUZZER_ALERT_QUEUE_SIZE];
+    uint8_t _count;
+    sfDevBuzzerAlert _current;
+    bool _playing;
+    uint16_t _sequence;
+    uint32_t _drops;
+    uint32_t _merges;
+};
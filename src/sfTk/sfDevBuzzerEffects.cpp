@@ -0,0 +1,287 @@
+/**
+ * @file    sfDevBuzzerEffects.cpp
+ * @brief   Built-in sound effects of the SparkFun Qwiic Buzzer Library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details Sound effects based on the following work:
+ *            Jan 21st, 2020
+ *            Snake In A Can Controller
+ *            Written by: Pete Lewis, with contributions from Jeff Haas
+ *            A collaboration with Mario the Maker Magician
+ *            https://www.mariothemagician.com/
+ *
+ *            January, 2021
+ *            Cry, Laugh Functions were adapted from Adafruit animal sounds
+ *            by Magician/hacker Jeff Haas. Thanks Jeff!!
+ *            https://learn.adafruit.com/adafruit-trinket-modded-stuffed-animal/animal-sounds
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerEffects.h"
+#include "sfDevBuzzerTuning.h"
+
+// Each array of segments is only compiled if an effect selected by
+// SFE_QWIIC_BUZZER_EFFECT_MASK uses it
+
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & (SFE_QWIIC_BUZZER_EFFECT_SIREN | SFE_QWIIC_BUZZER_EFFECT_YES_YELL |                 \
+                                    SFE_QWIIC_BUZZER_EFFECT_NO_YELL)
+// Siren: starts at a low frequency, increases rapidly up and then back down.
+// Its first and second halves are also the "YES!" and "NO!" effects.
+static const sfDevBuzzerSegment kSiren[] SFE_QWIIC_BUZZER_PROGMEM = {SFE_QWIIC_BUZZER_SWEEP(150, 4000, 150, 10),
+                                                                     SFE_QWIIC_BUZZER_SWEEP(4000, 150, -150, 10)};
+#endif
+
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_FAST_SIREN
+// Fast siren, played three times
+static const sfDevBuzzerSegment kFastSiren[] SFE_QWIIC_BUZZER_PROGMEM = {SFE_QWIIC_BUZZER_SWEEP(150, 4000, 150, 2),
+                                                                         SFE_QWIIC_BUZZER_SWEEP(4000, 150, -150, 2)};
+#endif
+
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_YES
+// Robot saying "Yes": a slow ramp up
+static const sfDevBuzzerSegment kYes[] SFE_QWIIC_BUZZER_PROGMEM = {SFE_QWIIC_BUZZER_SWEEP(150, 4000, 150, 40)};
+#endif
+
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_NO
+// Robot saying "No": a slow ramp down
+static const sfDevBuzzerSegment kNo[] SFE_QWIIC_BUZZER_PROGMEM = {SFE_QWIIC_BUZZER_SWEEP(4000, 150, -150, 40)};
+#endif
+
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_LAUGH
+// Laughing Robot: four short rising "ha"s
+static const sfDevBuzzerSegment kLaugh[] SFE_QWIIC_BUZZER_PROGMEM = {
+    SFE_QWIIC_BUZZER_SWEEP(1538, 1905, 10, 10), SFE_QWIIC_BUZZER_REST(400),
+    SFE_QWIIC_BUZZER_SWEEP(1250, 1515, 10, 10), SFE_QWIIC_BUZZER_REST(400),
+    SFE_QWIIC_BUZZER_SWEEP(1111, 1342, 10, 10), SFE_QWIIC_BUZZER_REST(400),
+    SFE_QWIIC_BUZZER_SWEEP(1010, 1176, 10, 10)};
+#endif
+
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_LAUGH_FAST
+static const sfDevBuzzerSegment kLaughFast[] SFE_QWIIC_BUZZER_PROGMEM = {
+    SFE_QWIIC_BUZZER_SWEEP(1538, 1905, 15, 10), SFE_QWIIC_BUZZER_REST(200),
+    SFE_QWIIC_BUZZER_SWEEP(1250, 1515, 15, 10), SFE_QWIIC_BUZZER_REST(200),
+    SFE_QWIIC_BUZZER_SWEEP(1111, 1342, 15, 10), SFE_QWIIC_BUZZER_REST(200),
+    SFE_QWIIC_BUZZER_SWEEP(1010, 1176, 15, 10)};
+#endif
+
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_CRY
+// Crying Robot: three falling sobs
+static const sfDevBuzzerSegment kCry[] SFE_QWIIC_BUZZER_PROGMEM = {
+    SFE_QWIIC_BUZZER_SWEEP(2000, 1429, -10, 10), SFE_QWIIC_BUZZER_REST(500),
+    SFE_QWIIC_BUZZER_SWEEP(1667, 1250, -10, 10), SFE_QWIIC_BUZZER_REST(500),
+    SFE_QWIIC_BUZZER_SWEEP(1429, 1053, -10, 10)};
+#endif
+
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_CRY_FAST
+static const sfDevBuzzerSegment kCryFast[] SFE_QWIIC_BUZZER_PROGMEM = {
+    SFE_QWIIC_BUZZER_SWEEP(2000, 1429, -20, 10), SFE_QWIIC_BUZZER_REST(200),
+    SFE_QWIIC_BUZZER_SWEEP(1667, 1250, -20, 10), SFE_QWIIC_BUZZER_REST(200),
+    SFE_QWIIC_BUZZER_SWEEP(1429, 1053, -20, 10)};
+#endif
+
+// An effect left out of SFE_QWIIC_BUZZER_EFFECT_MASK
+#define SFE_QWIIC_BUZZER_EFFECT_NONE {nullptr, 0, 0}
+
+#if SFE_QWIIC_BUZZER_EFFECT_MASK
+const sfDevBuzzerEffect kSfeQwiicBuzzerSoundEffects[SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT] SFE_QWIIC_BUZZER_PROGMEM = {
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_SIREN
+    SFE_QWIIC_BUZZER_EFFECT(kSiren, 1), // 0: Siren
+#else
+    SFE_QWIIC_BUZZER_EFFECT_NONE,
+#endif
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_FAST_SIREN
+    SFE_QWIIC_BUZZER_EFFECT(kFastSiren, 3), // 1: 3 Fast Sirens
+#else
+    SFE_QWIIC_BUZZER_EFFECT_NONE,
+#endif
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_YES
+    SFE_QWIIC_BUZZER_EFFECT(kYes, 1), // 2: Robot saying "Yes"
+#else
+    SFE_QWIIC_BUZZER_EFFECT_NONE,
+#endif
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_YES_YELL
+    {kSiren, 1, 1}, // 3: Robot yelling "YES!"
+#else
+    SFE_QWIIC_BUZZER_EFFECT_NONE,
+#endif
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_NO
+    SFE_QWIIC_BUZZER_EFFECT(kNo, 1), // 4: Robot saying "No"
+#else
+    SFE_QWIIC_BUZZER_EFFECT_NONE,
+#endif
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_NO_YELL
+    {kSiren + 1, 1, 1}, // 5: Robot yelling "NO!"
+#else
+    SFE_QWIIC_BUZZER_EFFECT_NONE,
+#endif
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_LAUGH
+    SFE_QWIIC_BUZZER_EFFECT(kLaugh, 1), // 6: Laughing Robot
+#else
+    SFE_QWIIC_BUZZER_EFFECT_NONE,
+#endif
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_LAUGH_FAST
+    SFE_QWIIC_BUZZER_EFFECT(kLaughFast, 1), // 7: Laughing Robot Faster
+#else
+    SFE_QWIIC_BUZZER_EFFECT_NONE,
+#endif
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_CRY
+    SFE_QWIIC_BUZZER_EFFECT(kCry, 1), // 8: Crying Robot
+#else
+    SFE_QWIIC_BUZZER_EFFECT_NONE,
+#endif
+#if SFE_QWIIC_BUZZER_EFFECT_MASK & SFE_QWIIC_BUZZER_EFFECT_CRY_FAST
+    SFE_QWIIC_BUZZER_EFFECT(kCryFast, 1)}; // 9: Crying Robot Faster
+#else
+    SFE_QWIIC_BUZZER_EFFECT_NONE};
+#endif
+#endif
+
+// Only the mask the library is compiled with links, see sfDevBuzzerEffectMask
+template <uint16_t Mask> void sfDevBuzzerEffectMask<Mask>::linked()
+{
+}
+
+template struct sfDevBuzzerEffectMask<SFE_QWIIC_BUZZER_EFFECT_MASK>;
+
+// The musical and exponential curves glide in pitch, in 1/65536 of a semitone
+// above or below the first frequency. Between two semitones, the frequency is
+// interpolated linearly, so the glides need no floating point math.
+static const int32_t kGlideSemitone = 65536;
+static const int32_t kGlideOctave = 12 * kGlideSemitone;
+
+/// @brief Next semitone ratio, as sfDevBuzzerSemitoneRatio() rounds it
+static uint64_t glideNextRatio(const uint64_t ratio)
+{
+    return (ratio * sfDevBuzzerSemitoneRatio(1) + (1 << 27)) >> 28;
+}
+
+/// @brief Pitch of a frequency relative to another one
+/// @param fromHz Frequency at pitch 0, not 0
+/// @param toHz The frequency, not 0
+/// @return The pitch, in 1/65536 of a semitone, negative below fromHz
+static int32_t glidePitch(const uint16_t fromHz, const uint16_t toHz)
+{
+    // Whole octaves first, leaving a ratio of 1 to 2
+    uint32_t base = fromHz;
+    uint32_t hz = toHz;
+    int32_t pitch = 0;
+    while (hz < base)
+    {
+        hz *= 2;
+        pitch -= kGlideOctave;
+    }
+    while (hz >= base * 2)
+    {
+        base *= 2;
+        pitch += kGlideOctave;
+    }
+
+    // Then whole semitones, and the rest of the way to the next semitone
+    uint64_t ratio = ((uint64_t)hz << 28) / base;
+    uint64_t below = sfDevBuzzerSemitoneRatio(0);
+    uint64_t above = glideNextRatio(below);
+    while (above <= ratio)
+    {
+        below = above;
+        above = glideNextRatio(below);
+        pitch += kGlideSemitone;
+    }
+    return pitch + (int32_t)(((ratio - below) * kGlideSemitone + (above - below) / 2) / (above - below));
+}
+
+/// @brief Frequency at a pitch relative to another one, the inverse of glidePitch()
+/// @param fromHz Frequency at pitch 0, not 0
+/// @param pitch The pitch, in 1/65536 of a semitone, negative below fromHz
+/// @return Frequency in Hz, rounded to the nearest
+static uint16_t glidePitchFrequency(const uint16_t fromHz, int32_t pitch)
+{
+    // Split the pitch in octaves, semitones and a fraction of a semitone, all
+    // rounded down as glidePitch() does
+    int8_t octaves = 0;
+    while (pitch < 0)
+    {
+        pitch += kGlideOctave;
+        octaves--;
+    }
+    octaves += pitch / kGlideOctave;
+    uint8_t semitone = pitch % kGlideOctave / kGlideSemitone;
+    uint32_t fraction = pitch % kGlideSemitone;
+
+    uint64_t below = sfDevBuzzerSemitoneRatio(semitone);
+    uint64_t above = glideNextRatio(below);
+    uint64_t scaled = fromHz * (below + ((above - below) * fraction + kGlideSemitone / 2) / kGlideSemitone);
+
+    uint8_t shift = 28;
+    if (octaves > 0)
+        scaled <<= octaves;
+    else
+        shift -= octaves;
+
+    uint64_t hz = (scaled + ((uint64_t)1 << (shift - 1))) >> shift;
+    return hz > 0xFFFF ? 0xFFFF : hz;
+}
+
+/// @brief Number of semitones between two frequencies, rounded
+static int16_t glideSemitones(const uint16_t fromHz, const uint16_t toHz)
+{
+    // Halfway between two semitones on the ear, 2^(1/24), is this far along
+    // the linear interpolation: (2^(1/24) - 1) / (2^(1/12) - 1) of a semitone
+    const int32_t kHalfway = 32295;
+
+    // Rounded down from 16 octaves below, so it rounds the same either way
+    return (glidePitch(fromHz, toHz) + 16 * kGlideOctave + kGlideSemitone - kHalfway) / kGlideSemitone - 16 * 12;
+}
+
+/// @brief Part of a distance covered by a step of a glide, rounded to the nearest
+static int32_t glideScale(const int32_t distance, const uint16_t step, const uint16_t steps)
+{
+    uint64_t magnitude = distance < 0 ? -distance : distance;
+    uint32_t scaled = (magnitude * step + (steps - 1) / 2) / (steps - 1);
+    return distance < 0 ? -(int32_t)scaled : (int32_t)scaled;
+}
+
+uint16_t sfDevBuzzerGlideSteps(const uint16_t fromHz, const uint16_t toHz, const uint16_t durationMs,
+                               const sfDevBuzzerGlideCurve curve, const uint16_t writesPerSecond)
+{
+    uint32_t steps = (uint32_t)durationMs * writesPerSecond / 1000;
+
+    // Steps that don't change the frequency would be skipped by the register
+    // cache anyway, and only make the other steps shorter
+    uint32_t distinct = toHz > fromHz ? toHz - fromHz + 1 : fromHz - toHz + 1;
+    if (curve == kSfeQwiicBuzzerGlideMusical && fromHz > 0 && toHz > 0)
+    {
+        int16_t semitones = glideSemitones(fromHz, toHz);
+        distinct = (semitones < 0 ? -semitones : semitones) + 1;
+    }
+
+    if (steps > distinct)
+        steps = distinct;
+    if (steps < 1)
+        steps = 1;
+    if (steps > 0xFFFF)
+        steps = 0xFFFF;
+    return steps;
+}
+
+uint16_t sfDevBuzzerGlideFrequency(const uint16_t fromHz, const uint16_t toHz, const uint16_t step,
+                                   const uint16_t steps, const sfDevBuzzerGlideCurve curve)
+{
+    if (steps <= 1 || step == 0)
+        return fromHz;
+    if (step >= steps - 1)
+        return toHz;
+
+    // The curves below need two real frequencies
+    if (fromHz == 0 || toHz == 0 || curve == kSfeQwiicBuzzerGlideLinear)
+        return fromHz + ((int32_t)toHz - fromHz) * step / (steps - 1);
+
+    if (curve == kSfeQwiicBuzzerGlideMusical)
+        return glidePitchFrequency(fromHz, glideScale(glideSemitones(fromHz, toHz), step, steps) * kGlideSemitone);
+
+    return glidePitchFrequency(fromHz, glideScale(glidePitch(fromHz, toHz), step, steps));
+}
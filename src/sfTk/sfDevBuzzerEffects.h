@@ -0,0 +1,181 @@
+/**
+ * @file    sfDevBuzzerEffects.h
+ * @brief   Header file defining the sound effect descriptors of the Qwiic Buzzer Library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares the descriptor format used for sound effects. A
+ *          sound effect is a list of segments, each one being a linear
+ *          frequency sweep, a glide or a rest, played a number of times. The built-in
+ *          effects are stored in program memory, and user-defined effects in the
+ *          same format can be registered with sfDevBuzzer::registerSoundEffect().
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// On AVR, constant data is copied to RAM unless it is explicitly placed in
+// program memory, and must then be read back with the pgmspace functions.
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define SFE_QWIIC_BUZZER_PROGMEM PROGMEM
+#else
+#define SFE_QWIIC_BUZZER_PROGMEM
+#endif
+
+/// @brief Copies a descriptor from program memory to RAM
+/// @param destination Where to copy the data
+/// @param source Address of the data in program memory
+/// @param size Number of bytes to copy
+inline void sfDevBuzzerReadProgmem(void *destination, const void *source, size_t size)
+{
+#if defined(__AVR__)
+    memcpy_P(destination, source, size);
+#else
+    memcpy(destination, source, size);
+#endif
+}
+
+/// @brief Shapes of a glide between two frequencies
+enum sfDevBuzzerGlideCurve : uint8_t
+{
+    kSfeQwiicBuzzerGlideLinear = 0,      ///< Same number of Hz per step
+    kSfeQwiicBuzzerGlideExponential = 1, ///< Same ratio per step, sounds even to the ear
+    kSfeQwiicBuzzerGlideMusical = 2,     ///< Exponential, rounded to semitones from the first frequency
+    kSfeQwiicBuzzerGlideCurveCount = 3
+};
+
+/// @brief One segment of a sound effect. A segment is either a linear
+/// frequency sweep, a rest (silence) when step is 0, or a glide when step is
+/// one of the SFE_QWIIC_BUZZER_GLIDE_STEP values.
+struct sfDevBuzzerSegment
+{
+    uint16_t startFrequency; ///< First frequency of the sweep in Hz
+    uint16_t endFrequency;   ///< The sweep stops before reaching this frequency, a glide ends on it
+    int16_t step;            ///< Frequency change per step in Hz (0 = rest)
+    uint16_t dwell;          ///< Time per sweep step (or rest length, or glide length) in milliseconds
+};
+
+/// @brief A sound effect, made of a list of segments played "repeat" times.
+/// Both the effect and its segments must be declared with
+/// SFE_QWIIC_BUZZER_PROGMEM, for example:
+///
+///     const sfDevBuzzerSegment kChirp[] SFE_QWIIC_BUZZER_PROGMEM = {
+///         SFE_QWIIC_BUZZER_SWEEP(1000, 3000, 200, 5), SFE_QWIIC_BUZZER_REST(100)};
+///     const sfDevBuzzerEffect kChirpEffect SFE_QWIIC_BUZZER_PROGMEM = SFE_QWIIC_BUZZER_EFFECT(kChirp, 2);
+struct sfDevBuzzerEffect
+{
+    const sfDevBuzzerSegment *segments; ///< Segments of the effect
+    uint8_t segmentCount;               ///< Number of segments
+    uint8_t repeat;                     ///< Number of times the segments are played
+};
+
+/// @brief Sweep from "from" Hz up (or down) to, but excluding, "to" Hz in
+/// steps of "step" Hz, holding each frequency for "dwell" milliseconds
+#define SFE_QWIIC_BUZZER_SWEEP(from, to, step, dwell) {from, to, step, dwell}
+
+/// @brief Value of the step field of a glide segment, a sweep step no real
+/// sweep uses
+#define SFE_QWIIC_BUZZER_GLIDE_STEP(curve) ((int16_t)(-32767 - 1 + (curve)))
+
+/// @brief Glide from "from" Hz to "to" Hz in "ms" milliseconds, following
+/// "curve" (a sfDevBuzzerGlideCurve). The number of steps is worked out when
+/// playing, from the write budget of the buzzer.
+#define SFE_QWIIC_BUZZER_GLIDE(from, to, ms, curve) {from, to, SFE_QWIIC_BUZZER_GLIDE_STEP(curve), ms}
+
+/// @brief Silence for "ms" milliseconds
+#define SFE_QWIIC_BUZZER_REST(ms) {0, 0, 0, ms}
+
+/// @brief Builds an effect from an array of segments, played "repeat" times
+#define SFE_QWIIC_BUZZER_EFFECT(segments, repeat)                                                                     \
+    {segments, sizeof(segments) / sizeof(segments[0]), repeat}
+
+#define SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT 10
+
+// Bits of SFE_QWIIC_BUZZER_EFFECT_MASK, one per built-in sound effect number
+#define SFE_QWIIC_BUZZER_EFFECT_SIREN 0x001      // 0: Siren
+#define SFE_QWIIC_BUZZER_EFFECT_FAST_SIREN 0x002 // 1: 3 Fast Sirens
+#define SFE_QWIIC_BUZZER_EFFECT_YES 0x004        // 2: Robot saying "Yes"
+#define SFE_QWIIC_BUZZER_EFFECT_YES_YELL 0x008   // 3: Robot yelling "YES!"
+#define SFE_QWIIC_BUZZER_EFFECT_NO 0x010         // 4: Robot saying "No"
+#define SFE_QWIIC_BUZZER_EFFECT_NO_YELL 0x020    // 5: Robot yelling "NO!"
+#define SFE_QWIIC_BUZZER_EFFECT_LAUGH 0x040      // 6: Laughing Robot
+#define SFE_QWIIC_BUZZER_EFFECT_LAUGH_FAST 0x080 // 7: Laughing Robot Faster
+#define SFE_QWIIC_BUZZER_EFFECT_CRY 0x100        // 8: Crying Robot
+#define SFE_QWIIC_BUZZER_EFFECT_CRY_FAST 0x200   // 9: Crying Robot Faster
+#define SFE_QWIIC_BUZZER_EFFECT_ALL 0x3FF
+
+// Built-in sound effects linked into the sketch. The segments of the effects
+// left out are not compiled, and playSoundEffect() and startSoundEffect()
+// reject their numbers; with no effect at all, the table of effects goes too.
+// Like SFE_QWIIC_BUZZER_INSTRUMENTATION, define it for the whole build (e.g.
+// -DSFE_QWIIC_BUZZER_EFFECT_MASK=0x041 for the Siren and the Laughing Robot).
+#ifndef SFE_QWIIC_BUZZER_EFFECT_MASK
+#define SFE_QWIIC_BUZZER_EFFECT_MASK SFE_QWIIC_BUZZER_EFFECT_ALL
+#endif
+
+/// @brief Ties a sketch to the SFE_QWIIC_BUZZER_EFFECT_MASK the library was
+/// compiled with. linked() is only defined for that mask, in
+/// sfDevBuzzerEffects.cpp, and QwiicBuzzer calls it with the mask the sketch
+/// sees: if the two differ, the sketch fails to link, with an undefined
+/// reference to sfDevBuzzerEffectMask<mask>::linked().
+/// @tparam Mask The mask, SFE_QWIIC_BUZZER_EFFECT_MASK
+template <uint16_t Mask> struct sfDevBuzzerEffectMask
+{
+    /// @brief Does nothing, but only links for the mask of the library
+    static void linked();
+};
+
+/// @brief Checks if a built-in sound effect is linked in, see
+/// SFE_QWIIC_BUZZER_EFFECT_MASK. Can be used in a static_assert() to make sure
+/// a sketch only uses effects that are.
+/// @param soundEffectNumber The sound effect number
+/// @return True if the effect is built in and selected
+constexpr bool sfDevBuzzerEffectSelected(const uint8_t soundEffectNumber)
+{
+    return soundEffectNumber < SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT &&
+           ((SFE_QWIIC_BUZZER_EFFECT_MASK >> soundEffectNumber) & 1) != 0;
+}
+
+/// @brief Checks if a segment is a glide
+/// @param segment The segment
+/// @return True for a glide, false for a sweep or a rest
+inline bool sfDevBuzzerIsGlide(const sfDevBuzzerSegment &segment)
+{
+    return segment.step < SFE_QWIIC_BUZZER_GLIDE_STEP(kSfeQwiicBuzzerGlideCurveCount);
+}
+
+/// @brief Works out the number of steps of a glide: as many as the write
+/// budget allows, but no more than one per Hz (per semitone for a musical
+/// glide)
+/// @param fromHz First frequency
+/// @param toHz Last frequency
+/// @param durationMs Length of the glide
+/// @param curve Shape of the glide
+/// @param writesPerSecond Write budget
+/// @return Number of steps, at least 1
+uint16_t sfDevBuzzerGlideSteps(const uint16_t fromHz, const uint16_t toHz, const uint16_t durationMs,
+                               const sfDevBuzzerGlideCurve curve, const uint16_t writesPerSecond);
+
+/// @brief Works out the frequency of one step of a glide. The first step is
+/// fromHz, the last one toHz.
+/// @param fromHz First frequency
+/// @param toHz Last frequency
+/// @param step Step, 0 to steps - 1
+/// @param steps Number of steps
+/// @param curve Shape of the glide
+/// @return Frequency in Hz
+uint16_t sfDevBuzzerGlideFrequency(const uint16_t fromHz, const uint16_t toHz, const uint16_t step,
+                                   const uint16_t steps, const sfDevBuzzerGlideCurve curve);
+
+/// @brief Built-in sound effects, indexed by sound effect number. Effects
+/// left out of SFE_QWIIC_BUZZER_EFFECT_MASK have no segments, and the table
+/// itself is only defined if at least one effect is selected.
+extern const sfDevBuzzerEffect kSfeQwiicBuzzerSoundEffects[SFE_QWIIC_BUZZER_SOUND_EFFECT_COUNT];
@@ -0,0 +1,119 @@
+/**
+ * @file    sfDevBuzzerGroup.cpp
+ * @brief   Implementation file for controlling several Qwiic Buzzers together
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file contains the implementation of the sfDevBuzzerGroup class.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerGroup.h"
+
+sfDevBuzzerGroup::sfDevBuzzerGroup(uint32_t (*clockUs)(void))
+    : _members{}, _count{0}, _clockUs{clockUs}, _skewUs{0}
+{
+}
+
+bool sfDevBuzzerGroup::add(sfDevBuzzer *buzzer)
+{
+    if (buzzer == nullptr || _count >= SFE_QWIIC_BUZZER_GROUP_SIZE)
+        return false;
+
+    _members[_count++] = buzzer;
+    return true;
+}
+
+void sfDevBuzzerGroup::clear()
+{
+    _count = 0;
+}
+
+uint8_t sfDevBuzzerGroup::size()
+{
+    return _count;
+}
+
+sfTkError_t sfDevBuzzerGroup::configureBuzzer(const uint16_t toneFrequency, const uint16_t duration,
+                                              const uint8_t volume)
+{
+    sfTkError_t result = ksfTkErrOk;
+
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        sfTkError_t err = _members[i]->configureBuzzer(toneFrequency, duration, volume);
+        // Keep the first error, but configure the others anyway
+        if (err != ksfTkErrOk && result == ksfTkErrOk)
+            result = err;
+    }
+    return result;
+}
+
+sfTkError_t sfDevBuzzerGroup::on()
+{
+    sfTkError_t result = ksfTkErrOk;
+    uint32_t firstUs = 0;
+    uint32_t lastUs = 0;
+    bool started = false;
+    bool failed[SFE_QWIIC_BUZZER_GROUP_SIZE];
+
+    // Everything was loaded by configureBuzzer(), so this loop is only the
+    // ACTIVE writes, one attempt each so that a failing buzzer doesn't delay
+    // the others with its retries. The clock is read after each one, when it
+    // takes effect.
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        failed[i] = _members[i]->tryOn() != ksfTkErrOk;
+        if (!failed[i])
+            markStart(started, firstUs, lastUs);
+    }
+
+    // Then the buzzers that failed, with their retries
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        if (!failed[i])
+            continue;
+
+        sfTkError_t err = _members[i]->on();
+        if (err == ksfTkErrOk)
+            markStart(started, firstUs, lastUs);
+        else if (result == ksfTkErrOk)
+            result = err;
+    }
+
+    _skewUs = lastUs - firstUs;
+    return result;
+}
+
+sfTkError_t sfDevBuzzerGroup::off()
+{
+    sfTkError_t result = ksfTkErrOk;
+
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        sfTkError_t err = _members[i]->off();
+        if (err != ksfTkErrOk && result == ksfTkErrOk)
+            result = err;
+    }
+    return result;
+}
+
+void sfDevBuzzerGroup::markStart(bool &started, uint32_t &firstUs, uint32_t &lastUs)
+{
+    if (_clockUs == nullptr)
+        return;
+
+    lastUs = _clockUs();
+    if (!started)
+        firstUs = lastUs;
+    started = true;
+}
+
+uint32_t sfDevBuzzerGroup::skewUs()
+{
+    return _skewUs;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file    sfDevBuzzerGroup.h
+ * @brief   Header file for controlling several Qwiic Buzzers together
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares the sfDevBuzzerGroup class, which starts a number
+ *          of buzzers at (nearly) the same time. The tone, volume and duration
+ *          of every member are loaded ahead of time with configureBuzzer(), so
+ *          starting the group is only a burst of one-byte ACTIVE writes.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzer.h"
+
+#define SFE_QWIIC_BUZZER_GROUP_SIZE 16
+
+class sfDevBuzzerGroup
+{
+  public:
+    /// @brief Constructor
+    /// @param clockUs Function returning the time in microseconds (e.g. micros()),
+    /// used to measure the start skew. nullptr disables the measurement.
+    sfDevBuzzerGroup(uint32_t (*clockUs)(void) = nullptr);
+
+    /// @brief Adds a buzzer to the group. The buzzer must have been begun.
+    /// @param buzzer The buzzer to add
+    /// @return True if successful, false if the group is full
+    bool add(sfDevBuzzer *buzzer);
+
+    /// @brief Removes all the buzzers from the group
+    void clear();
+
+    /// @brief Gets the number of buzzers in the group
+    /// @return Number of buzzers
+    uint8_t size();
+
+    /// @brief Configures every buzzer of the group without causing them to
+    /// buzz, so that on() only has to write ACTIVE
+    /// @param toneFrequency Frequency in Hz of buzzer tone
+    /// @param duration Duration in milliseconds (0 = forever)
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @return 0 for succuss, or the first error met
+    sfTkError_t configureBuzzer(const uint16_t toneFrequency = SFE_QWIIC_BUZZER_RESONANT_FREQUENCY,
+                                const uint16_t duration = 0, const uint8_t volume = 4);
+
+    /// @brief Turns on every buzzer of the group, back-to-back. Each buzzer
+    /// gets a single attempt during the burst, so a failing buzzer does not
+    /// hold up the others; the ones that failed are then turned on again with
+    /// their retries.
+    /// @return 0 for succuss, or the first error met
+    sfTkError_t on();
+
+    /// @brief Turns off every buzzer of the group
+    /// @return 0 for succuss, or the first error met
+    sfTkError_t off();
+
+    /// @brief Gets the time between the first and the last buzzer being turned
+    /// on by the last call to on()
+    /// @return Skew in microseconds, 0 if no clock was given
+    uint32_t skewUs();
+
+  private:
+    /// @brief Reads the clock after a buzzer was turned on
+    /// @param started A buzzer was already turned on by this call to on(), set
+    /// @param firstUs Time the first buzzer was turned on, set if !started
+    /// @param lastUs Time the last buzzer was turned on
+    void markStart(bool &started, uint32_t &firstUs, uint32_t &lastUs);
+
+    sfDevBuzzer *_members[SFE_QWIIC_BUZZER_GROUP_SIZE];
+    uint8_t _count;
+    uint32_t (*_clockUs)(void);
+    uint32_t _skewUs;
+};
@@ -0,0 +1,84 @@
+/**
+ * @file    sfDevBuzzerInstrumentation.h
+ * @brief   Header file for the optional instrumentation of the Qwiic Buzzer library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares the counters kept by sfDevBuzzer when
+ *          SFE_QWIIC_BUZZER_INSTRUMENTATION is set to 1: for each group of
+ *          methods, the number of calls, I2C transactions and data bytes, and a
+ *          histogram of the time each call took.
+ *
+ *          The instrumentation is off by default, and then compiles to nothing:
+ *          no counters in sfDevBuzzer, and no code in its methods. To turn it
+ *          on, define SFE_QWIIC_BUZZER_INSTRUMENTATION to 1 for the whole build
+ *          (e.g. -DSFE_QWIIC_BUZZER_INSTRUMENTATION=1 in the build flags), not
+ *          just in the sketch: the counters change the layout of sfDevBuzzer,
+ *          so QwiicBuzzer::begin() fails to link if the sketch and the library
+ *          disagree (see sfDevBuzzerInstrumentationFlag). It costs
+ *          kSfeQwiicBuzzerApiCount * sizeof(sfDevBuzzerApiStats) bytes of RAM
+ *          per buzzer.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifndef SFE_QWIIC_BUZZER_INSTRUMENTATION
+#define SFE_QWIIC_BUZZER_INSTRUMENTATION 0
+#endif
+
+/// @brief Ties a sketch to the SFE_QWIIC_BUZZER_INSTRUMENTATION the library
+/// was compiled with, which changes the layout of sfDevBuzzer. linked() is
+/// only defined for that value, in sfDevBuzzer.cpp, and QwiicBuzzer calls it
+/// with the value the sketch sees: if the two differ, the sketch fails to
+/// link, with an undefined reference to sfDevBuzzerInstrumentationFlag<value>::linked(),
+/// rather than running with the wrong layout.
+/// @tparam Enabled The value of SFE_QWIIC_BUZZER_INSTRUMENTATION
+template <uint8_t Enabled> struct sfDevBuzzerInstrumentationFlag
+{
+    /// @brief Does nothing, but only links for the value of the library
+    static void linked();
+};
+
+// Number of latency buckets. Bucket i counts the calls shorter than
+// SFE_QWIIC_BUZZER_LATENCY_BUCKET_US << i microseconds, the last one the rest.
+#define SFE_QWIIC_BUZZER_LATENCY_BUCKETS 8
+#define SFE_QWIIC_BUZZER_LATENCY_BUCKET_US 64
+
+/// @brief Groups of methods counted by the instrumentation. A call made from
+/// within another counted call is counted with the outer one (e.g. the on() and
+/// off() of a sound effect count as kSfeQwiicBuzzerApiEffect).
+enum sfDevBuzzerApi : uint8_t
+{
+    kSfeQwiicBuzzerApiConfigure = 0,    ///< configureBuzzer()
+    kSfeQwiicBuzzerApiPlay = 1,         ///< play()
+    kSfeQwiicBuzzerApiOn = 2,           ///< on()
+    kSfeQwiicBuzzerApiOff = 3,          ///< off()
+    kSfeQwiicBuzzerApiSetAddress = 4,   ///< setAddress()
+    kSfeQwiicBuzzerApiSaveSettings = 5, ///< saveSettings(), flushSettings() and saves committed by update()
+    kSfeQwiicBuzzerApiEffect = 6,       ///< playSoundEffect(), stopSoundEffect() and sound effect steps of update()
+    kSfeQwiicBuzzerApiConfig = 7,       ///< readConfig() and writeConfig()
+    kSfeQwiicBuzzerApiOther = 8,        ///< Everything else, e.g. begin(), isActive() and idle callback polls
+    kSfeQwiicBuzzerApiCount = 9
+};
+
+/// @brief Counters of one group of methods
+struct sfDevBuzzerApiStats
+{
+    uint32_t calls;                                     ///< Number of calls
+    uint32_t transactions;                              ///< I2C transactions, retries included
+    uint32_t bytes;                                     ///< Data bytes written and read
+    uint32_t maxUs;                                     ///< Longest call, in microseconds
+    uint32_t latency[SFE_QWIIC_BUZZER_LATENCY_BUCKETS]; ///< Calls per latency bucket
+};
+
+/// @brief Snapshot of all instrumentation counters of a buzzer
+struct sfDevBuzzerInstrumentation
+{
+    sfDevBuzzerApiStats api[kSfeQwiicBuzzerApiCount]; ///< Counters, indexed by sfDevBuzzerApi
+};
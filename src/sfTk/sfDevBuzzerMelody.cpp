@@ -0,0 +1,261 @@
+/**
+ * @file    sfDevBuzzerMelody.cpp
+ * @brief   Implementation file for the packed melody format and melody player
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file contains the implementation of the melody sources and player.
+ *          Notes are looked up in the pitch tables of sfDevBuzzerTuning.h.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerMelody.h"
+
+#include <string.h>
+
+uint16_t sfDevBuzzerNoteFrequency(const uint8_t noteIndex)
+{
+    if (noteIndex == SFE_QWIIC_BUZZER_MELODY_REST || noteIndex >= SFE_QWIIC_BUZZER_MELODY_NOTE_COUNT)
+        return 0;
+
+    sfDevBuzzerPitch pitch = sfDevBuzzerReadPitch(sfDevBuzzerStandardTuning::pitches, sfDevBuzzerNoteMidi(noteIndex));
+    return (pitch.msb << 8) | pitch.lsb;
+}
+
+sfDevBuzzerMelodyArray::sfDevBuzzerMelodyArray(const uint8_t *data, const size_t length)
+    : _data{data}, _length{length}, _position{0}
+{
+}
+
+int16_t sfDevBuzzerMelodyArray::read()
+{
+    if (_data == nullptr || _position >= _length)
+        return SFE_QWIIC_BUZZER_MELODY_SOURCE_END;
+
+    uint8_t value;
+    sfDevBuzzerReadProgmem(&value, &_data[_position++], 1);
+    return value;
+}
+
+void sfDevBuzzerMelodyArray::rewind()
+{
+    _position = 0;
+}
+
+sfDevBuzzerMelodyReader::sfDevBuzzerMelodyReader()
+    : _source{nullptr}, _wholeNoteMs{SFE_QWIIC_BUZZER_MELODY_DEFAULT_WHOLE_NOTE},
+      _lastDuration{SFE_QWIIC_BUZZER_MELODY_QUARTER}, _pendingNote{-1}, _ended{true}
+{
+}
+
+void sfDevBuzzerMelodyReader::start(sfDevBuzzerMelodySource *source, const uint16_t wholeNoteMs)
+{
+    _source = source;
+    _wholeNoteMs = wholeNoteMs;
+    _lastDuration = SFE_QWIIC_BUZZER_MELODY_QUARTER;
+    _pendingNote = -1;
+    _ended = source == nullptr;
+}
+
+bool sfDevBuzzerMelodyReader::read(sfDevBuzzerMelodyEvent &event)
+{
+    if (_ended)
+        return false;
+
+    int16_t noteByte = _pendingNote;
+    if (noteByte < 0)
+        noteByte = _source->read();
+
+    if (noteByte == SFE_QWIIC_BUZZER_MELODY_SOURCE_WAIT)
+        return false;
+
+    if (noteByte < 0 || (noteByte & ~SFE_QWIIC_BUZZER_MELODY_SAME) == SFE_QWIIC_BUZZER_MELODY_END)
+    {
+        _ended = true;
+        return false;
+    }
+
+    // Read the duration, unless it is the same as the previous event's
+    uint8_t duration = _lastDuration;
+    if (!(noteByte & SFE_QWIIC_BUZZER_MELODY_SAME))
+    {
+        int16_t durationByte = _source->read();
+        if (durationByte == SFE_QWIIC_BUZZER_MELODY_SOURCE_WAIT)
+        {
+            // Keep the note byte until the rest of the event arrives
+            _pendingNote = noteByte;
+            return false;
+        }
+        if (durationByte < 0)
+        {
+            _ended = true;
+            return false;
+        }
+        duration = durationByte;
+        _lastDuration = duration;
+    }
+    _pendingNote = -1;
+
+    // Length of the note: a fraction of a whole note, maybe dotted
+    uint32_t wholeNoteMs = _source->wholeNoteMs();
+    if (wholeNoteMs == 0)
+        wholeNoteMs = _wholeNoteMs;
+    uint32_t soundMs = wholeNoteMs >> (duration & 0x07);
+    if (duration & SFE_QWIIC_BUZZER_MELODY_DOTTED)
+        soundMs += soundMs / 2;
+    if (soundMs > 0xFFFF)
+        soundMs = 0xFFFF;
+    // A note too short to last a millisecond must not get duration 0, which
+    // would play it forever
+    if (soundMs == 0)
+        soundMs = 1;
+
+    // Like Example_07_Melody, leave a gap of 30% between notes
+    uint32_t periodMs = soundMs;
+    if (!(duration & SFE_QWIIC_BUZZER_MELODY_LEGATO))
+        periodMs += soundMs * 3 / 10;
+    if (periodMs > 0xFFFF)
+        periodMs = 0xFFFF;
+
+    // Indices beyond the table are played as rests
+    uint8_t noteIndex = noteByte & ~SFE_QWIIC_BUZZER_MELODY_SAME;
+    event.noteIndex = noteIndex < SFE_QWIIC_BUZZER_MELODY_NOTE_COUNT ? noteIndex : SFE_QWIIC_BUZZER_MELODY_REST;
+    event.soundMs = soundMs;
+    event.periodMs = periodMs;
+    return true;
+}
+
+bool sfDevBuzzerMelodyReader::ended()
+{
+    return _ended;
+}
+
+sfDevBuzzerMelodyPlayer::sfDevBuzzerMelodyPlayer()
+    : _buzzer{nullptr}, _reader{}, _volume{4}, _pitches{sfDevBuzzerStandardTuning::pitches}, _transpose{0}, _next{},
+      _nextReady{false}, _playing{false}, _started{false}, _due{0}, _stats{0, 0, 0, 0, 0, 0, 0}
+{
+}
+
+void sfDevBuzzerMelodyPlayer::start(sfDevBuzzer *buzzer, sfDevBuzzerMelodySource *source, const uint8_t volume,
+                                    const uint16_t wholeNoteMs)
+{
+    _buzzer = buzzer;
+    _reader.start(source, wholeNoteMs);
+    _volume = volume;
+    _nextReady = false;
+    _started = false;
+    _playing = buzzer != nullptr && source != nullptr;
+}
+
+sfTkError_t sfDevBuzzerMelodyPlayer::update(const uint32_t nowMs)
+{
+    if (!_playing)
+        return ksfTkErrOk;
+
+    // Decode the next event ahead of time, if it wasn't already
+    if (!_nextReady)
+        prefetch();
+
+    // Wait for the current event to finish
+    if (_started && (int32_t)(nowMs - _due) < 0)
+        return ksfTkErrOk;
+
+    if (!_nextReady)
+    {
+        // Either the melody is over, or its data is late
+        if (_reader.ended())
+            _playing = false;
+        return ksfTkErrOk;
+    }
+
+    // Rests need no write: the previous note was given a duration, and has
+    // already turned itself off
+    sfTkError_t err = ksfTkErrOk;
+    if (_next.event.noteIndex != SFE_QWIIC_BUZZER_MELODY_REST)
+        err = _buzzer->play(_next.note);
+
+    // The next event is due a period after this one was, however long the
+    // write took
+    if (!_started)
+        _due = nowMs;
+    _started = true;
+    sfDevBuzzerScheduleStep(_stats, _due, nowMs, _next.event.periodMs);
+    _nextReady = false;
+
+    if (err != ksfTkErrOk)
+    {
+        _playing = false;
+        return err;
+    }
+
+    // Get the following event ready while this one plays
+    prefetch();
+
+    return ksfTkErrOk;
+}
+
+void sfDevBuzzerMelodyPlayer::setTranspose(const int8_t semitones)
+{
+    _transpose = semitones;
+
+    // The next note was decoded with the old transposition
+    if (_nextReady)
+        decode();
+}
+
+void sfDevBuzzerMelodyPlayer::setTuning(const sfDevBuzzerPitch *pitches)
+{
+    _pitches = pitches != nullptr ? pitches : sfDevBuzzerStandardTuning::pitches;
+
+    // The next note was decoded in the old tuning
+    if (_nextReady)
+        decode();
+}
+
+bool sfDevBuzzerMelodyPlayer::isPlaying()
+{
+    return _playing;
+}
+
+sfTkError_t sfDevBuzzerMelodyPlayer::stop()
+{
+    _playing = false;
+    if (_buzzer == nullptr)
+        return ksfTkErrOk;
+
+    return _buzzer->off();
+}
+
+void sfDevBuzzerMelodyPlayer::timingStats(sfDevBuzzerTimingStats &stats)
+{
+    stats = _stats;
+}
+
+void sfDevBuzzerMelodyPlayer::resetTimingStats()
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+bool sfDevBuzzerMelodyPlayer::prefetch()
+{
+    if (!_reader.read(_next.event))
+        return false;
+
+    decode();
+    _nextReady = true;
+    return true;
+}
+
+void sfDevBuzzerMelodyPlayer::decode()
+{
+    if (_next.event.noteIndex == SFE_QWIIC_BUZZER_MELODY_REST)
+        return;
+
+    // The register bytes come straight from the pitch table
+    uint8_t midiNote = sfDevBuzzerTranspose(sfDevBuzzerNoteMidi(_next.event.noteIndex), _transpose);
+    sfDevBuzzer::makeNote(_next.note, sfDevBuzzerReadPitch(_pitches, midiNote), _next.event.soundMs, _volume);
+}
@@ -0,0 +1,257 @@
+/**
+ * @file    sfDevBuzzerMelody.h
+ * @brief   Header file for the packed melody format and melody player
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares a compact melody format and a non-blocking player
+ *          for it. A melody is a list of events of 1 or 2 bytes each:
+ *
+ *          - Byte 0, bits 0-6: note index, 0 for a rest, 1 (B0) to 89 (DS8) for
+ *            the notes of sfDevBuzzerPitches.h, or SFE_QWIIC_BUZZER_MELODY_END.
+ *          - Byte 0, bit 7: set when the event has the same duration as the
+ *            previous one, in which case there is no byte 1.
+ *          - Byte 1, bits 0-2: the note lasts 1/2^n of a whole note (0 = whole,
+ *            2 = quarter, ...). Bit 3: dotted. Bit 4: legato, no gap after
+ *            the note. Bits 5-7: reserved, 0.
+ *
+ *          Like Example_07_Melody, each note sounds for its duration, followed
+ *          by a gap of 30% of its duration unless it is legato. The player can
+ *          transpose the melody and play it in another tuning, see
+ *          sfDevBuzzerTuning.h.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzer.h"
+
+#define SFE_QWIIC_BUZZER_MELODY_REST 0
+#define SFE_QWIIC_BUZZER_MELODY_END 0x7F
+#define SFE_QWIIC_BUZZER_MELODY_SAME 0x80
+#define SFE_QWIIC_BUZZER_MELODY_NOTE_COUNT 90
+
+#define SFE_QWIIC_BUZZER_MELODY_WHOLE 0
+#define SFE_QWIIC_BUZZER_MELODY_HALF 1
+#define SFE_QWIIC_BUZZER_MELODY_QUARTER 2
+#define SFE_QWIIC_BUZZER_MELODY_EIGHTH 3
+#define SFE_QWIIC_BUZZER_MELODY_SIXTEENTH 4
+#define SFE_QWIIC_BUZZER_MELODY_THIRTY_SECOND 5
+#define SFE_QWIIC_BUZZER_MELODY_SIXTY_FOURTH 6
+#define SFE_QWIIC_BUZZER_MELODY_DOTTED 0x08
+#define SFE_QWIIC_BUZZER_MELODY_LEGATO 0x10
+
+#define SFE_QWIIC_BUZZER_MELODY_DEFAULT_WHOLE_NOTE 1000
+
+// Returned by sfDevBuzzerMelodySource::read()
+#define SFE_QWIIC_BUZZER_MELODY_SOURCE_END -1
+#define SFE_QWIIC_BUZZER_MELODY_SOURCE_WAIT -2
+
+/// @brief Semitones within an octave, for sfDevBuzzerNoteIndex()
+enum sfDevBuzzerSemitone : uint8_t
+{
+    kSfeQwiicBuzzerC = 0,
+    kSfeQwiicBuzzerCS = 1,
+    kSfeQwiicBuzzerD = 2,
+    kSfeQwiicBuzzerDS = 3,
+    kSfeQwiicBuzzerE = 4,
+    kSfeQwiicBuzzerF = 5,
+    kSfeQwiicBuzzerFS = 6,
+    kSfeQwiicBuzzerG = 7,
+    kSfeQwiicBuzzerGS = 8,
+    kSfeQwiicBuzzerA = 9,
+    kSfeQwiicBuzzerAS = 10,
+    kSfeQwiicBuzzerB = 11
+};
+
+/// @brief Gets the note index of a note, for the packed melody format. Notes
+/// outside of B0 to DS8 are clamped to that range.
+/// @param semitone Semitone within the octave, C = 0
+/// @param octave Octave, 4 for the octave starting at middle C
+/// @return Note index, 1 (B0) to 89 (DS8)
+constexpr uint8_t sfDevBuzzerNoteIndex(const uint8_t semitone, const uint8_t octave)
+{
+    // C1 is index 2, so B0 is index 1
+    return octave * 12 + semitone < 11 ? 1 : octave * 12 + semitone > 99 ? 89 : octave * 12 + semitone - 10;
+}
+
+/// @brief Gets the MIDI note number of a note index of the packed melody format
+/// @param noteIndex Note index, 1 (B0) to 89 (DS8)
+/// @return MIDI note number, 23 (B0) to 111 (DS8)
+constexpr uint8_t sfDevBuzzerNoteMidi(const uint8_t noteIndex)
+{
+    return noteIndex + 22;
+}
+
+/// @brief Gets the frequency of a note index of the packed melody format
+/// @param noteIndex Note index, 0 (rest) to 89 (DS8)
+/// @return Frequency in Hz, 0 for rests and invalid indices
+uint16_t sfDevBuzzerNoteFrequency(const uint8_t noteIndex);
+
+/// @brief Where the player reads a melody from, one byte at a time
+class sfDevBuzzerMelodySource
+{
+  public:
+    /// @brief Reads the next byte of the melody
+    /// @return The byte, SFE_QWIIC_BUZZER_MELODY_SOURCE_END at the end of the
+    /// melody, or SFE_QWIIC_BUZZER_MELODY_SOURCE_WAIT if the next byte has not
+    /// arrived yet (the player tries again on its next update)
+    virtual int16_t read() = 0;
+
+    /// @brief Gets the tempo of the melody, for sources that carry their own
+    /// (e.g. RTTTL text)
+    /// @return Length of a whole note in milliseconds, 0 to use the one given
+    /// to the player
+    virtual uint16_t wholeNoteMs()
+    {
+        return 0;
+    }
+};
+
+/// @brief A melody stored in an array, in program memory
+class sfDevBuzzerMelodyArray : public sfDevBuzzerMelodySource
+{
+  public:
+    /// @brief Constructor
+    /// @param data The melody, declared with SFE_QWIIC_BUZZER_PROGMEM
+    /// @param length Number of bytes
+    sfDevBuzzerMelodyArray(const uint8_t *data, const size_t length);
+
+    /// @brief Reads the next byte of the melody
+    /// @return The byte, or SFE_QWIIC_BUZZER_MELODY_SOURCE_END
+    int16_t read();
+
+    /// @brief Goes back to the start of the melody
+    void rewind();
+
+  private:
+    const uint8_t *_data;
+    size_t _length;
+    size_t _position;
+};
+
+/// @brief One event of a packed melody, decoded
+struct sfDevBuzzerMelodyEvent
+{
+    uint8_t noteIndex; ///< Note index, SFE_QWIIC_BUZZER_MELODY_REST for a rest
+    uint16_t soundMs;  ///< Length of the note in milliseconds
+    uint16_t periodMs; ///< Time until the next event, the gap between notes included
+};
+
+/// @brief Reads a melody in the packed format from a source, one event at a
+/// time. Used by the players, each track having its own reader.
+class sfDevBuzzerMelodyReader
+{
+  public:
+    /// @brief Default constructor
+    sfDevBuzzerMelodyReader();
+
+    /// @brief Starts reading a melody
+    /// @param source Where to read the melody from
+    /// @param wholeNoteMs Length of a whole note in milliseconds, unless the
+    /// source has its own tempo
+    void start(sfDevBuzzerMelodySource *source, const uint16_t wholeNoteMs);
+
+    /// @brief Reads and decodes the next event
+    /// @param event Where the event is stored
+    /// @return True if an event was read, false if the melody has ended or
+    /// its data has not arrived yet
+    bool read(sfDevBuzzerMelodyEvent &event);
+
+    /// @brief Checks if the melody has ended
+    /// @return True once the source has no more events
+    bool ended();
+
+  private:
+    sfDevBuzzerMelodySource *_source;
+    uint16_t _wholeNoteMs;
+    uint8_t _lastDuration;
+    int16_t _pendingNote; // note byte read while its duration byte was not available yet
+    bool _ended;
+};
+
+/// @brief Non-blocking player for the packed melody format. While a note is
+/// playing, the next event is already read and turned into register values,
+/// so that when it is due, update() only has to write them.
+class sfDevBuzzerMelodyPlayer
+{
+  public:
+    /// @brief Default constructor
+    sfDevBuzzerMelodyPlayer();
+
+    /// @brief Starts a melody. It is played by calling update() from your loop.
+    /// @param buzzer The buzzer to play on
+    /// @param source Where to read the melody from
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @param wholeNoteMs Length of a whole note in milliseconds (sets the tempo)
+    void start(sfDevBuzzer *buzzer, sfDevBuzzerMelodySource *source, const uint8_t volume = 4,
+               const uint16_t wholeNoteMs = SFE_QWIIC_BUZZER_MELODY_DEFAULT_WHOLE_NOTE);
+
+    /// @brief Advances the player. Only writes to the buzzer when the next
+    /// note is due, otherwise returns immediately.
+    /// @param nowMs Current time in milliseconds (e.g. millis())
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t update(const uint32_t nowMs);
+
+    /// @brief Transposes the melody, from its next note on (the note already
+    /// decoded ahead of time is decoded again). Notes are kept within MIDI
+    /// notes 0 to 127.
+    /// @param semitones Number of semitones, negative to go down (12 = an octave up)
+    void setTranspose(const int8_t semitones);
+
+    /// @brief Plays the melody in another tuning, from its next note on (the
+    /// note already decoded ahead of time is decoded again)
+    /// @param pitches Pitch table of the tuning, e.g. sfDevBuzzerTuning<432>::pitches,
+    /// or nullptr for the standard tuning (A4 = 440Hz)
+    void setTuning(const sfDevBuzzerPitch *pitches);
+
+    /// @brief Checks if a melody is playing
+    /// @return True if a melody is playing, false otherwise
+    bool isPlaying();
+
+    /// @brief Stops the melody, and turns off the buzzer
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t stop();
+
+    /// @brief Gets how well the events kept to their schedule. Each event is
+    /// due a fixed time after the previous one was due, so late updates don't
+    /// add up over the melody.
+    /// @param stats Variable where the statistics will be stored
+    void timingStats(sfDevBuzzerTimingStats &stats);
+
+    /// @brief Sets all timing statistics to 0
+    void resetTimingStats();
+
+  private:
+    /// @brief An event of the melody, decoded and ready to be played
+    struct Event
+    {
+        sfDevBuzzerMelodyEvent event; ///< The event as read, to decode it again
+        sfDevBuzzerNote note;         ///< Register values, unused for rests
+    };
+
+    /// @brief Reads and decodes the next event of the melody into _next
+    /// @return True if an event is ready, false if the melody has ended or
+    /// its data has not arrived yet
+    bool prefetch();
+
+    /// @brief Works out the register values of _next, with the current
+    /// transposition, tuning and volume
+    void decode();
+
+    sfDevBuzzer *_buzzer;
+    sfDevBuzzerMelodyReader _reader;
+    uint8_t _volume;
+    const sfDevBuzzerPitch *_pitches;
+    int8_t _transpose;
+
+    Event _next;
+    bool _nextReady;
+    bool _playing;
+    bool _started; // the first event has been played
+    uint32_t _due;
+    sfDevBuzzerTimingStats _stats;
+};
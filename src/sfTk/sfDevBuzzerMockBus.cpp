@@ -0,0 +1,361 @@
+/**
+ * @file    sfDevBuzzerMockBus.cpp
+ * @brief   Implementation file for an emulated Qwiic Buzzer on a simulated I2C bus
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file contains the implementation of the sfDevBuzzerMockBus class.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerMockBus.h"
+
+// Bit times of the parts of a transaction: START and STOP (or repeated START)
+// are one bit time each, and every byte is 8 bits plus ACK
+const uint32_t kStartStopBits = 1;
+const uint32_t kByteBits = 9;
+
+// Values of the identification registers of the emulated buzzer
+const uint8_t kMockDeviceId = 0x5E;
+const uint8_t kMockFirmwareMinor = 0x00;
+const uint8_t kMockFirmwareMajor = 0x01;
+const uint16_t kMockDefaultFrequency = 2730;
+const uint8_t kMockDefaultVolume = 4;
+
+sfDevBuzzerMockBus::sfDevBuzzerMockBus(const uint8_t address, const uint32_t clockHz)
+    : _registers{}, _eeprom{}, _deviceAddress{address}, _clockHz{clockHz}, _nowUs{0}, _activeEndUs{0}, _saveCount{0},
+      _faultCount{0}, _faultPeriod{0}, _faultPhase{0}, _transactions{0}, _bytesWritten{0}, _bytesRead{0},
+      _wireBytes{0}, _busTimeUs{0}, _log{}, _logNext{0}, _logCount{0}
+{
+    // Factory settings
+    _eeprom[kSfeQwiicBuzzerRegId] = kMockDeviceId;
+    _eeprom[kSfeQwiicBuzzerRegFirmwareMinor] = kMockFirmwareMinor;
+    _eeprom[kSfeQwiicBuzzerRegFirmwareMajor] = kMockFirmwareMajor;
+    _eeprom[kSfeQwiicBuzzerRegToneFrequencyMsb] = (kMockDefaultFrequency >> 8);
+    _eeprom[kSfeQwiicBuzzerRegToneFrequencyLsb] = (kMockDefaultFrequency & 0xFF);
+    _eeprom[kSfeQwiicBuzzerRegVolume] = kMockDefaultVolume;
+    _eeprom[kSfeQwiicBuzzerRegI2cAddress] = address;
+
+    powerCycle();
+
+    // Talk to the emulated buzzer by default
+    setAddress(address);
+}
+
+sfTkError_t sfDevBuzzerMockBus::ping()
+{
+    bool acked = address() == _deviceAddress && !faulted();
+    record(kSfeQwiicBuzzerMockPing, 0, 0, acked);
+
+    return acked ? ksfTkErrOk : ksfTkErrFail;
+}
+
+sfTkError_t sfDevBuzzerMockBus::writeData(const uint8_t *data, size_t length)
+{
+    if (data == nullptr || length == 0)
+        return ksfTkErrFail;
+
+    // The first byte sets the register pointer
+    uint8_t devReg = data[0];
+    return writeRegister(&devReg, 1, data + 1, length - 1);
+}
+
+sfTkError_t sfDevBuzzerMockBus::writeRegister(uint8_t *devReg, size_t regLength, const uint8_t *data, size_t length)
+{
+    if (devReg == nullptr || regLength != 1 || (data == nullptr && length > 0))
+        return ksfTkErrFail;
+
+    updateDevice();
+
+    bool acked = address() == _deviceAddress && !faulted();
+    record(kSfeQwiicBuzzerMockWrite, *devReg, length, acked);
+    if (!acked)
+        return ksfTkErrFail;
+
+    // Registers are written in order, the pointer increments after each byte
+    for (size_t i = 0; i < length; i++)
+        writeDevice(*devReg + i, data[i]);
+
+    return ksfTkErrOk;
+}
+
+sfTkError_t sfDevBuzzerMockBus::readRegister(uint8_t *devReg, size_t regLength, uint8_t *data, size_t numBytes,
+                                             size_t &readBytes, uint32_t read_delay)
+{
+    (void)read_delay;
+    readBytes = 0;
+
+    if (devReg == nullptr || regLength != 1 || data == nullptr)
+        return ksfTkErrFail;
+
+    updateDevice();
+
+    bool acked = address() == _deviceAddress && !faulted();
+    record(kSfeQwiicBuzzerMockRead, *devReg, numBytes, acked);
+    if (!acked)
+        return ksfTkErrFail;
+
+    for (size_t i = 0; i < numBytes; i++)
+        data[i] = registerValue(*devReg + i);
+    readBytes = numBytes;
+
+    return ksfTkErrOk;
+}
+
+void sfDevBuzzerMockBus::setClock(const uint32_t clockHz)
+{
+    if (clockHz > 0)
+        _clockHz = clockHz;
+}
+
+uint32_t sfDevBuzzerMockBus::clock()
+{
+    return _clockHz;
+}
+
+void sfDevBuzzerMockBus::advanceTime(const uint32_t ms)
+{
+    _nowUs += (uint64_t)ms * 1000;
+    updateDevice();
+}
+
+uint32_t sfDevBuzzerMockBus::nowUs()
+{
+    return (uint32_t)_nowUs;
+}
+
+uint32_t sfDevBuzzerMockBus::nowMs()
+{
+    return (uint32_t)(_nowUs / 1000);
+}
+
+void sfDevBuzzerMockBus::powerCycle()
+{
+    // The buzzer starts silent, with the settings saved in its EEPROM
+    for (uint8_t i = 0; i < SFE_QWIIC_BUZZER_MOCK_REGISTER_COUNT; i++)
+        _registers[i] = _eeprom[i];
+
+    _registers[kSfeQwiicBuzzerRegActive] = 0;
+    _registers[kSfeQwiicBuzzerRegSaveSettings] = 0;
+    _deviceAddress = _eeprom[kSfeQwiicBuzzerRegI2cAddress];
+}
+
+void sfDevBuzzerMockBus::injectFaults(const uint8_t count, const uint16_t period)
+{
+    _faultCount = count;
+    _faultPeriod = period;
+    _faultPhase = 0;
+}
+
+bool sfDevBuzzerMockBus::faulted()
+{
+    if (_faultCount > 0)
+    {
+        _faultCount--;
+        return true;
+    }
+
+    if (_faultPeriod == 0 || ++_faultPhase < _faultPeriod)
+        return false;
+
+    _faultPhase = 0;
+    return true;
+}
+
+uint8_t sfDevBuzzerMockBus::registerValue(const uint8_t devReg)
+{
+    if (devReg >= SFE_QWIIC_BUZZER_MOCK_REGISTER_COUNT)
+        return 0;
+
+    return _registers[devReg];
+}
+
+uint8_t sfDevBuzzerMockBus::deviceAddress()
+{
+    return _deviceAddress;
+}
+
+uint32_t sfDevBuzzerMockBus::saveCount()
+{
+    return _saveCount;
+}
+
+void sfDevBuzzerMockBus::resetStats()
+{
+    _transactions = 0;
+    _bytesWritten = 0;
+    _bytesRead = 0;
+    _wireBytes = 0;
+    _busTimeUs = 0;
+    _logNext = 0;
+    _logCount = 0;
+}
+
+uint32_t sfDevBuzzerMockBus::transactions()
+{
+    return _transactions;
+}
+
+uint32_t sfDevBuzzerMockBus::bytesWritten()
+{
+    return _bytesWritten;
+}
+
+uint32_t sfDevBuzzerMockBus::bytesRead()
+{
+    return _bytesRead;
+}
+
+uint32_t sfDevBuzzerMockBus::wireBytes()
+{
+    return _wireBytes;
+}
+
+uint32_t sfDevBuzzerMockBus::busTimeUs()
+{
+    return _busTimeUs;
+}
+
+uint8_t sfDevBuzzerMockBus::logCount()
+{
+    return _logCount;
+}
+
+bool sfDevBuzzerMockBus::logEntry(const uint8_t index, sfDevBuzzerMockTransaction &transaction)
+{
+    if (index >= _logCount)
+        return false;
+
+    // The log is a ring buffer, the oldest entry is the one about to be overwritten
+    uint8_t oldest = (_logNext + SFE_QWIIC_BUZZER_MOCK_LOG_SIZE - _logCount) % SFE_QWIIC_BUZZER_MOCK_LOG_SIZE;
+    transaction = _log[(oldest + index) % SFE_QWIIC_BUZZER_MOCK_LOG_SIZE];
+    return true;
+}
+
+void sfDevBuzzerMockBus::record(const sfDevBuzzerMockTransactionType type, const uint8_t devReg, const size_t length,
+                                const bool acked)
+{
+    // Every transaction starts with START and the address byte. Without an
+    // ACK, the controller gives up with a STOP.
+    uint32_t bits = kStartStopBits + kByteBits;
+    uint32_t wire = 1;
+
+    if (acked)
+    {
+        switch (type)
+        {
+        case kSfeQwiicBuzzerMockWrite:
+            // Register pointer and data
+            bits += kByteBits * (1 + length);
+            wire += 1 + length;
+            _bytesWritten += length;
+            break;
+        case kSfeQwiicBuzzerMockRead:
+            // Register pointer, repeated START, address again and data
+            bits += kByteBits + kStartStopBits + kByteBits + kByteBits * length;
+            wire += 2 + length;
+            _bytesRead += length;
+            break;
+        default:
+            break;
+        }
+    }
+    bits += kStartStopBits;
+
+    sfDevBuzzerMockTransaction &entry = _log[_logNext];
+    entry.type = type;
+    entry.address = address();
+    entry.devReg = devReg;
+    entry.length = length > 0xFF ? 0xFF : length;
+    entry.acked = acked;
+    entry.startUs = (uint32_t)_nowUs;
+    entry.durationUs = bitsToUs(bits);
+
+    _logNext = (_logNext + 1) % SFE_QWIIC_BUZZER_MOCK_LOG_SIZE;
+    if (_logCount < SFE_QWIIC_BUZZER_MOCK_LOG_SIZE)
+        _logCount++;
+
+    _transactions++;
+    _wireBytes += wire;
+    _busTimeUs += entry.durationUs;
+    _nowUs += entry.durationUs;
+}
+
+void sfDevBuzzerMockBus::updateDevice()
+{
+    uint16_t duration =
+        (_registers[kSfeQwiicBuzzerRegDurationMsb] << 8) | _registers[kSfeQwiicBuzzerRegDurationLsb];
+
+    if (_registers[kSfeQwiicBuzzerRegActive] && duration != 0 && _nowUs >= _activeEndUs)
+        _registers[kSfeQwiicBuzzerRegActive] = 0;
+}
+
+void sfDevBuzzerMockBus::writeDevice(const uint8_t devReg, const uint8_t value)
+{
+    switch (devReg)
+    {
+    case kSfeQwiicBuzzerRegToneFrequencyMsb:
+    case kSfeQwiicBuzzerRegToneFrequencyLsb:
+    case kSfeQwiicBuzzerRegVolume:
+    case kSfeQwiicBuzzerRegDurationMsb:
+    case kSfeQwiicBuzzerRegDurationLsb:
+        _registers[devReg] = value;
+        break;
+
+    case kSfeQwiicBuzzerRegActive: {
+        // Turning on (again) starts the duration, if one is set
+        uint16_t duration =
+            (_registers[kSfeQwiicBuzzerRegDurationMsb] << 8) | _registers[kSfeQwiicBuzzerRegDurationLsb];
+        _registers[kSfeQwiicBuzzerRegActive] = value ? 1 : 0;
+        _activeEndUs = _nowUs + (uint32_t)duration * 1000;
+        break;
+    }
+
+    case kSfeQwiicBuzzerRegSaveSettings:
+        // Settings are committed to EEPROM, and the register clears itself
+        if (value)
+        {
+            for (uint8_t reg = kSfeQwiicBuzzerRegToneFrequencyMsb; reg <= kSfeQwiicBuzzerRegDurationLsb; reg++)
+                _eeprom[reg] = _registers[reg];
+            _eeprom[kSfeQwiicBuzzerRegI2cAddress] = _registers[kSfeQwiicBuzzerRegI2cAddress];
+            _saveCount++;
+        }
+        break;
+
+    case kSfeQwiicBuzzerRegI2cAddress:
+        // Invalid addresses are ignored, valid ones take effect right away
+        if (value >= 0x08 && value <= 0x77)
+        {
+            _registers[kSfeQwiicBuzzerRegI2cAddress] = value;
+            _deviceAddress = value;
+        }
+        break;
+
+    default:
+        // Identification registers are read only
+        break;
+    }
+}
+
+uint32_t sfDevBuzzerMockBus::bitsToUs(const uint32_t bits)
+{
+    return (uint32_t)(((uint64_t)bits * 1000000 + _clockHz / 2) / _clockHz);
+}
+
+sfDevBuzzerMockClock::sfDevBuzzerMockClock(sfDevBuzzerMockBus &bus) : _bus{bus}
+{
+}
+
+uint32_t sfDevBuzzerMockClock::ticksMs()
+{
+    return _bus.nowMs();
+}
+
+void sfDevBuzzerMockClock::delayMs(const uint32_t ms)
+{
+    _bus.advanceTime(ms);
+}
@@ -0,0 +1,244 @@
+/**
+ * @file    sfDevBuzzerMockBus.h
+ * @brief   Header file for an emulated Qwiic Buzzer on a simulated I2C bus
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares the sfDevBuzzerMockBus class, an sfTkII2C bus
+ *          with an emulated Qwiic Buzzer on it. It implements the register map
+ *          of the buzzer (0x00 to 0x0A), including duration timeouts, saving
+ *          settings and changing the I2C address, and records every transaction
+ *          together with the time it would take on a real bus.
+ *
+ *          It only depends on the SparkFun Toolkit bus interface, so sfDevBuzzer
+ *          can be exercised without hardware, on a board or on a host computer,
+ *          and the bus cost of each API call can be measured.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzerRegisters.h"
+#include "sfDevBuzzerTiming.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// include the sparkfun toolkit headers
+#include <sfTk/sfToolkit.h>
+
+// Bus interfaces
+#include <sfTk/sfTkII2C.h>
+
+#define SFE_QWIIC_BUZZER_MOCK_REGISTER_COUNT 11
+#define SFE_QWIIC_BUZZER_MOCK_LOG_SIZE 32
+
+/// @brief Kinds of transactions recorded by the mock bus
+enum sfDevBuzzerMockTransactionType : uint8_t
+{
+    kSfeQwiicBuzzerMockPing = 0,
+    kSfeQwiicBuzzerMockWrite = 1,
+    kSfeQwiicBuzzerMockRead = 2
+};
+
+/// @brief One transaction on the mock bus
+struct sfDevBuzzerMockTransaction
+{
+    sfDevBuzzerMockTransactionType type; ///< Ping, write or read
+    uint8_t address;                     ///< 7-bit address the transaction was sent to
+    uint8_t devReg;                      ///< First register (not used for pings)
+    uint8_t length;                      ///< Number of data bytes written or read
+    bool acked;                          ///< False if no device answered
+    uint32_t startUs;                    ///< Simulated time at the start of the transaction
+    uint32_t durationUs;                 ///< Simulated time on the bus
+};
+
+class sfDevBuzzerMockBus : public sfTkII2C
+{
+  public:
+    /// @brief Constructor
+    /// @param address I2C address of the emulated buzzer
+    /// @param clockHz Simulated I2C clock, used for the timing model
+    sfDevBuzzerMockBus(const uint8_t address = 0x34, const uint32_t clockHz = 100000);
+
+    // Keep the convenience overloads of the toolkit visible
+    using sfTkII2C::readRegister;
+    using sfTkII2C::writeRegister;
+
+    /// @brief Pings the bus address
+    /// @return 0 if the emulated buzzer answers, negative for errors
+    sfTkError_t ping();
+
+    /// @brief Writes raw data; the first byte is the register pointer
+    /// @param data Data to write
+    /// @param length Number of bytes
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t writeData(const uint8_t *data, size_t length);
+
+    /// @brief Writes registers of the emulated buzzer
+    /// @param devReg Register pointer (one byte)
+    /// @param regLength Length of the register pointer, must be 1
+    /// @param data Data to write
+    /// @param length Number of bytes
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t writeRegister(uint8_t *devReg, size_t regLength, const uint8_t *data, size_t length);
+
+    /// @brief Reads registers of the emulated buzzer
+    /// @param devReg Register pointer (one byte)
+    /// @param regLength Length of the register pointer, must be 1
+    /// @param data Buffer for the data
+    /// @param numBytes Number of bytes to read
+    /// @param readBytes Number of bytes read
+    /// @param read_delay Delay between the write of the pointer and the read, ignored
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t readRegister(uint8_t *devReg, size_t regLength, uint8_t *data, size_t numBytes, size_t &readBytes,
+                             uint32_t read_delay = 0);
+
+    /// @brief Sets the simulated I2C clock
+    /// @param clockHz Clock in Hz, e.g. 100000, 400000 or 1000000
+    void setClock(const uint32_t clockHz);
+
+    /// @brief Gets the simulated I2C clock
+    /// @return Clock in Hz
+    uint32_t clock();
+
+    /// @brief Moves simulated time forward, e.g. to let a buzz with a duration end
+    /// @param ms Number of milliseconds
+    void advanceTime(const uint32_t ms);
+
+    /// @brief Gets the simulated time, which includes the time spent on the bus
+    /// @return Simulated time in microseconds, wrapping around like micros()
+    uint32_t nowUs();
+
+    /// @brief Gets the simulated time, which includes the time spent on the bus
+    /// @return Simulated time in milliseconds, wrapping around like millis()
+    uint32_t nowMs();
+
+    /// @brief Power cycles the emulated buzzer, reloading its saved settings
+    void powerCycle();
+
+    /// @brief Makes the emulated buzzer NAK transactions, as on a noisy bus
+    /// @param count Number of transactions to NAK, starting with the next one
+    /// @param period After those, NAK one transaction out of period (0 = none)
+    void injectFaults(const uint8_t count, const uint16_t period = 0);
+
+    /// @brief Gets the value of a register of the emulated buzzer
+    /// @param devReg Register, kSfeQwiicBuzzerRegId to kSfeQwiicBuzzerRegI2cAddress
+    /// @return Register value, 0 for registers out of range
+    uint8_t registerValue(const uint8_t devReg);
+
+    /// @brief Gets the I2C address the emulated buzzer answers to
+    /// @return 7-bit address
+    uint8_t deviceAddress();
+
+    /// @brief Gets the number of times the settings were saved to EEPROM
+    /// @return Number of saves
+    uint32_t saveCount();
+
+    /// @brief Clears the transaction log and all counters
+    void resetStats();
+
+    /// @brief Gets the number of transactions since the last resetStats()
+    /// @return Number of transactions, including pings and NAKed ones
+    uint32_t transactions();
+
+    /// @brief Gets the number of data bytes written since the last resetStats()
+    /// @return Number of bytes, not counting addresses and register pointers
+    uint32_t bytesWritten();
+
+    /// @brief Gets the number of data bytes read since the last resetStats()
+    /// @return Number of bytes, not counting addresses and register pointers
+    uint32_t bytesRead();
+
+    /// @brief Gets the number of bytes on the wire since the last resetStats()
+    /// @return Number of bytes, including addresses and register pointers
+    uint32_t wireBytes();
+
+    /// @brief Gets the simulated bus occupancy since the last resetStats()
+    /// @return Time in microseconds
+    uint32_t busTimeUs();
+
+    /// @brief Gets the number of transactions in the log. The log keeps the
+    /// most recent SFE_QWIIC_BUZZER_MOCK_LOG_SIZE transactions.
+    /// @return Number of logged transactions
+    uint8_t logCount();
+
+    /// @brief Gets a transaction from the log
+    /// @param index 0 for the oldest logged transaction
+    /// @param transaction Where the transaction is copied
+    /// @return True if the index is valid, false otherwise
+    bool logEntry(const uint8_t index, sfDevBuzzerMockTransaction &transaction);
+
+  private:
+    /// @brief Records a transaction, and moves simulated time forward by its bus time
+    /// @param type Ping, write or read
+    /// @param devReg First register
+    /// @param length Number of data bytes
+    /// @param acked False if no device answered
+    void record(const sfDevBuzzerMockTransactionType type, const uint8_t devReg, const size_t length,
+                const bool acked);
+
+    /// @brief Turns off the buzzer once its duration has elapsed
+    void updateDevice();
+
+    /// @brief Checks if a transaction to the emulated buzzer should be NAKed
+    /// @return True for an injected fault
+    bool faulted();
+
+    /// @brief Applies a write of one register
+    /// @param devReg Register
+    /// @param value Value written
+    void writeDevice(const uint8_t devReg, const uint8_t value);
+
+    /// @brief Converts a number of bit times to microseconds at the current clock
+    /// @param bits Number of bit times
+    /// @return Time in microseconds
+    uint32_t bitsToUs(const uint32_t bits);
+
+    uint8_t _registers[SFE_QWIIC_BUZZER_MOCK_REGISTER_COUNT];
+    uint8_t _eeprom[SFE_QWIIC_BUZZER_MOCK_REGISTER_COUNT];
+    uint8_t _deviceAddress;
+    uint32_t _clockHz;
+    uint64_t _nowUs;       // 64 bits, so that nowMs() wraps at 2^32 ms, not at 2^32 us
+    uint64_t _activeEndUs;
+    uint32_t _saveCount;
+    uint8_t _faultCount;
+    uint16_t _faultPeriod;
+    uint16_t _faultPhase;
+
+    uint32_t _transactions;
+    uint32_t _bytesWritten;
+    uint32_t _bytesRead;
+    uint32_t _wireBytes;
+    uint32_t _busTimeUs;
+
+    sfDevBuzzerMockTransaction _log[SFE_QWIIC_BUZZER_MOCK_LOG_SIZE];
+    uint8_t _logNext;
+    uint8_t _logCount;
+};
+
+/// @brief A clock that follows the simulated time of a mock bus. Waiting
+/// returns at once and moves simulated time forward, so effects and melodies
+/// run as fast as the host can go, while the transaction log still records
+/// when each transaction would have happened.
+class sfDevBuzzerMockClock : public sfDevBuzzerClock
+{
+  public:
+    /// @brief Constructor
+    /// @param bus The mock bus whose simulated time is used
+    sfDevBuzzerMockClock(sfDevBuzzerMockBus &bus);
+
+    /// @brief Gets the simulated time, which includes the time spent on the bus
+    /// @return Time in milliseconds
+    uint32_t ticksMs();
+
+    /// @brief Moves simulated time forward
+    /// @param ms Number of milliseconds
+    void delayMs(const uint32_t ms);
+
+  private:
+    sfDevBuzzerMockBus &_bus;
+};
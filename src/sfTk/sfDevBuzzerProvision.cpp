@@ -0,0 +1,165 @@
+/**
+ * @file    sfDevBuzzerProvision.cpp
+ * @brief   Implementation file for giving many Qwiic Buzzers their I2C addresses
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file contains the implementation of the sfDevBuzzerProvisioner class.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerProvision.h"
+
+sfDevBuzzerProvisioner::sfDevBuzzerProvisioner()
+    : _theBus{nullptr}, _buzzer{}, _targets{nullptr}, _count{0}, _lastAddress{0}, _assigned{}, _collisions{}
+{
+}
+
+sfTkError_t sfDevBuzzerProvisioner::begin(sfTkII2C *theBus, const uint8_t *targets, const uint8_t count)
+{
+    // Nullptr check
+    if (theBus == nullptr || (targets == nullptr && count > 0))
+        return ksfTkErrFail;
+
+    // Check the target addresses are in the legal range
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (targets[i] < SFE_QWIIC_BUZZER_ADDRESS_MIN || targets[i] > SFE_QWIIC_BUZZER_ADDRESS_MAX)
+            return ksfTkErrFail;
+    }
+
+    _theBus = theBus;
+    _targets = targets;
+    _count = count;
+    _lastAddress = 0;
+    _assigned.clear();
+    _collisions.clear();
+
+    return ksfTkErrOk;
+}
+
+sfDevBuzzerProvisionResult sfDevBuzzerProvisioner::update()
+{
+    uint8_t index = nextTarget();
+    if (_theBus == nullptr || index >= _count)
+        return kSfeQwiicBuzzerProvisionDone;
+
+    // Has a new buzzer been attached?
+    _theBus->setAddress(SFE_QWIIC_BUZZER_DEFAULT_ADDRESS);
+    if (_buzzer.begin(_theBus) != ksfTkErrOk)
+        return kSfeQwiicBuzzerProvisionWaiting;
+
+    // Skip the targets where another device already answers. The default
+    // address can't be checked, the new buzzer is there.
+    uint8_t target = _targets[index];
+    while (target != SFE_QWIIC_BUZZER_DEFAULT_ADDRESS)
+    {
+        _theBus->setAddress(target);
+        if (_theBus->ping() != ksfTkErrOk)
+            break;
+
+        _collisions.add(target);
+        index = nextTarget();
+        if (index >= _count)
+        {
+            _theBus->setAddress(SFE_QWIIC_BUZZER_DEFAULT_ADDRESS);
+            return kSfeQwiicBuzzerProvisionDone;
+        }
+        target = _targets[index];
+    }
+    _theBus->setAddress(SFE_QWIIC_BUZZER_DEFAULT_ADDRESS);
+
+    // Move the buzzer, the bus follows it
+    if (target != SFE_QWIIC_BUZZER_DEFAULT_ADDRESS && _buzzer.setAddress(target) != ksfTkErrOk)
+    {
+        rollback(target);
+        return kSfeQwiicBuzzerProvisionFailed;
+    }
+
+    // Check it answers at its new address, and knows it
+    sfDevBuzzerConfig config;
+    if (_buzzer.readConfig(config) != ksfTkErrOk || config.deviceId != SFE_QWIIC_BUZZER_DEVICE_ID ||
+        config.address != target)
+    {
+        rollback(target);
+        return kSfeQwiicBuzzerProvisionFailed;
+    }
+
+    // Keep the address across power cycles
+    if (_buzzer.saveSettings() != ksfTkErrOk)
+    {
+        rollback(target);
+        return kSfeQwiicBuzzerProvisionFailed;
+    }
+
+    _assigned.add(target);
+    _lastAddress = target;
+    return kSfeQwiicBuzzerProvisionAssigned;
+}
+
+bool sfDevBuzzerProvisioner::isDone()
+{
+    return nextTarget() >= _count;
+}
+
+uint8_t sfDevBuzzerProvisioner::remaining()
+{
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        if (!_assigned.contains(_targets[i]) && !_collisions.contains(_targets[i]))
+            count++;
+    }
+    return count;
+}
+
+uint8_t sfDevBuzzerProvisioner::lastAddress()
+{
+    return _lastAddress;
+}
+
+const sfDevBuzzerAddressSet &sfDevBuzzerProvisioner::assigned()
+{
+    return _assigned;
+}
+
+const sfDevBuzzerAddressSet &sfDevBuzzerProvisioner::collisions()
+{
+    return _collisions;
+}
+
+uint8_t sfDevBuzzerProvisioner::nextTarget()
+{
+    uint8_t defaultIndex = _count;
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        uint8_t target = _targets[i];
+        if (_assigned.contains(target) || _collisions.contains(target))
+            continue;
+
+        // Once the default address is taken, no new buzzer can be detected
+        if (target == SFE_QWIIC_BUZZER_DEFAULT_ADDRESS)
+        {
+            if (defaultIndex == _count)
+                defaultIndex = i;
+            continue;
+        }
+        return i;
+    }
+    return defaultIndex;
+}
+
+void sfDevBuzzerProvisioner::rollback(const uint8_t address)
+{
+    // Best effort, the buzzer may not have moved at all
+    if (address != SFE_QWIIC_BUZZER_DEFAULT_ADDRESS)
+    {
+        _theBus->setAddress(address);
+        _theBus->writeRegister(kSfeQwiicBuzzerRegI2cAddress, (uint8_t)SFE_QWIIC_BUZZER_DEFAULT_ADDRESS);
+    }
+    _theBus->setAddress(SFE_QWIIC_BUZZER_DEFAULT_ADDRESS);
+}
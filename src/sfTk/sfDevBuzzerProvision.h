@@ -0,0 +1,102 @@
+/**
+ * @file    sfDevBuzzerProvision.h
+ * @brief   Header file for giving many Qwiic Buzzers their I2C addresses
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares the sfDevBuzzerProvisioner class, which gives
+ *          buzzers their addresses from a list, as they are attached one at a
+ *          time to a shared bus. Every buzzer ships at the default address
+ *          (0x34): each time a buzzer shows up there, it is moved to the next
+ *          free target address, verified, and the address is saved. A buzzer
+ *          that fails verification is moved back to the default address, so
+ *          it can be attached again.
+ *
+ *          Target addresses where another device already answers are skipped
+ *          and reported as collisions. A target equal to the default address
+ *          is given out last, since no further buzzer can be detected once it
+ *          is taken.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzer.h"
+#include "sfDevBuzzerScan.h"
+
+/// @brief What a call to sfDevBuzzerProvisioner::update() did
+enum sfDevBuzzerProvisionResult : uint8_t
+{
+    kSfeQwiicBuzzerProvisionWaiting = 0,  ///< No buzzer at the default address
+    kSfeQwiicBuzzerProvisionAssigned = 1, ///< A buzzer was moved to a target address, see lastAddress()
+    kSfeQwiicBuzzerProvisionFailed = 2,   ///< A buzzer failed verification and was moved back, attach it again
+    kSfeQwiicBuzzerProvisionDone = 3      ///< Every target address is assigned, or collides with another device
+};
+
+class sfDevBuzzerProvisioner
+{
+  public:
+    /// @brief Default constructor
+    sfDevBuzzerProvisioner();
+
+    /// @brief Starts provisioning. The provisioner changes the address of the
+    /// bus as it goes, and leaves it at the last address assigned.
+    /// @param theBus The bus the buzzers are attached to
+    /// @param targets Addresses to give the buzzers, in order. The array must
+    /// stay valid until provisioning is done.
+    /// @param count Number of addresses in targets
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t begin(sfTkII2C *theBus, const uint8_t *targets, const uint8_t count);
+
+    /// @brief Checks for a buzzer at the default address and, if there is one,
+    /// gives it the next free target address. Call this repeatedly while the
+    /// buzzers are attached, one at a time.
+    ///
+    /// Waiting costs one ping. Assigning costs one ping per target checked for
+    /// collisions, plus an ID read, the address write, one read of the whole
+    /// register map to verify it and the save.
+    /// @return What was done
+    sfDevBuzzerProvisionResult update();
+
+    /// @brief Checks if provisioning is done
+    /// @return True if every target address is assigned or collides
+    bool isDone();
+
+    /// @brief Gets the number of target addresses not assigned yet
+    /// @return Number of addresses
+    uint8_t remaining();
+
+    /// @brief Gets the address given to the last buzzer provisioned
+    /// @return Address, or 0 if none was assigned yet
+    uint8_t lastAddress();
+
+    /// @brief Gets the addresses assigned so far
+    /// @return Set of addresses
+    const sfDevBuzzerAddressSet &assigned();
+
+    /// @brief Gets the target addresses skipped because another device
+    /// already answers there
+    /// @return Set of addresses
+    const sfDevBuzzerAddressSet &collisions();
+
+  private:
+    /// @brief Finds the next target address that is not assigned or
+    /// colliding, the default address coming last
+    /// @return Index in the targets, or the number of targets if none is left
+    uint8_t nextTarget();
+
+    /// @brief Moves the buzzer back to the default address after a failure
+    /// @param address Address the buzzer may have moved to
+    void rollback(const uint8_t address);
+
+    sfTkII2C *_theBus;
+    sfDevBuzzer _buzzer;
+    const uint8_t *_targets;
+    uint8_t _count;
+    uint8_t _lastAddress;
+    sfDevBuzzerAddressSet _assigned;
+    sfDevBuzzerAddressSet _collisions;
+};
@@ -0,0 +1,218 @@
+/**
+ * @file    sfDevBuzzerRegisterCache.h
+ * @brief   Header file for the register cache of the Qwiic Buzzer library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file defines sfDevBuzzerRegisterCache, which mirrors the tone,
+ *          volume, duration and ACTIVE registers of a Qwiic Buzzer so that only
+ *          the registers that changed are written. It is shared by sfDevBuzzer
+ *          and sfDevBuzzerT, which differ only in how they reach the bus.
+ *
+ *          ACTIVE needs care: with a duration set, the buzzer turns itself
+ *          off, so a cached 1 doesn't mean it is still buzzing. Whenever the
+ *          duration is set or not known, ACTIVE is written anyway, and
+ *          forgotten again after the write.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzerRegisters.h"
+
+#include <stdint.h>
+#include <string.h>
+
+// include the sparkfun toolkit headers
+#include <sfTk/sfToolkit.h>
+
+// Number of registers mirrored by the register cache, kSfeQwiicBuzzerRegToneFrequencyMsb
+// to kSfeQwiicBuzzerRegActive
+#define SFE_QWIIC_BUZZER_CACHED_REGISTERS 6
+
+/// @brief Last values written to the registers kSfeQwiicBuzzerRegToneFrequencyMsb
+/// to kSfeQwiicBuzzerRegActive, with one valid bit per register. The writes go
+/// through a Driver, which must have a method
+/// sfTkError_t writeRegisters(const uint8_t devReg, const uint8_t *data, const size_t length)
+/// accessible to this class (e.g. by making it a friend).
+class sfDevBuzzerRegisterCache
+{
+  public:
+    /// @brief Default constructor, nothing is known
+    sfDevBuzzerRegisterCache() : _values{}, _valid{0}
+    {
+    }
+
+    /// @brief Forgets every register
+    void invalidate()
+    {
+        _valid = 0;
+    }
+
+    /// @brief Forgets the value of the ACTIVE register, so it is written next time
+    void invalidateActive()
+    {
+        _valid &= ~registerBit(kSfeQwiicBuzzerRegActive);
+    }
+
+    /// @brief Sets every register to the values read from the buzzer
+    /// @param registers Values of kSfeQwiicBuzzerRegToneFrequencyMsb to
+    /// kSfeQwiicBuzzerRegActive
+    void fill(const uint8_t *registers)
+    {
+        memcpy(_values, registers, SFE_QWIIC_BUZZER_CACHED_REGISTERS);
+        _valid = (1 << SFE_QWIIC_BUZZER_CACHED_REGISTERS) - 1;
+    }
+
+    /// @brief Checks if a range of registers is known
+    /// @param devReg First register, in the cached range
+    /// @param length Number of registers
+    /// @return True if all of them are known
+    bool known(const uint8_t devReg, const uint8_t length)
+    {
+        uint8_t bits = ((1 << length) - 1) << (devReg - kSfeQwiicBuzzerRegToneFrequencyMsb);
+        return (_valid & bits) == bits;
+    }
+
+    /// @brief Gets the cached values, valid where known() says so
+    /// @return Values of kSfeQwiicBuzzerRegToneFrequencyMsb to kSfeQwiicBuzzerRegActive
+    const uint8_t *values()
+    {
+        return _values;
+    }
+
+    /// @brief Gets the duration set on the buzzer
+    /// @param duration Variable where the duration in milliseconds will be stored
+    /// @return True if the duration is known
+    bool duration(uint16_t &duration)
+    {
+        if (!known(kSfeQwiicBuzzerRegDurationMsb, 2))
+            return false;
+
+        duration = (_values[kDurationMsb] << 8) | _values[kDurationLsb];
+        return true;
+    }
+
+    /// @brief Checks if the buzzer may turn itself off, because a duration is
+    /// set or not known
+    /// @return True if the cached ACTIVE value can't be relied on
+    bool deviceTimed()
+    {
+        uint16_t ms;
+        return !duration(ms) || ms != 0;
+    }
+
+    /// @brief Writes registers through the cache. Only the smallest contiguous
+    /// span of bytes that differ from the cached values is written, and nothing
+    /// at all if none differ.
+    /// @param driver Driver whose writeRegisters() does the write
+    /// @param devReg First register, in the cached range
+    /// @param data Values of the registers
+    /// @param length Number of registers
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    template <class Driver>
+    sfTkError_t write(Driver &driver, const uint8_t devReg, const uint8_t *data, const size_t length)
+    {
+        uint8_t offset = devReg - kSfeQwiicBuzzerRegToneFrequencyMsb;
+
+        // Find the first and last bytes that differ from the cache
+        size_t first = length;
+        size_t last = 0;
+        for (size_t i = 0; i < length; i++)
+        {
+            uint8_t mask = 1 << (offset + i);
+            if (!(_valid & mask) || _values[offset + i] != data[i])
+            {
+                if (first == length)
+                    first = i;
+                last = i;
+            }
+        }
+
+        // Nothing changed, nothing to write
+        if (first == length)
+            return ksfTkErrOk;
+
+        size_t span = last - first + 1;
+        uint8_t spanBits = ((1 << span) - 1) << (offset + first);
+
+        sfTkError_t err = driver.writeRegisters(devReg + first, data + first, span);
+
+        // Check whether the write was successful. If not, the state of these
+        // registers on the device is unknown.
+        if (err != ksfTkErrOk)
+        {
+            _valid &= ~spanBits;
+            return err;
+        }
+
+        memcpy(&_values[offset + first], data + first, span);
+        _valid |= spanBits;
+
+        return ksfTkErrOk;
+    }
+
+    /// @brief Writes a whole note, ACTIVE included, in a single transaction.
+    /// ACTIVE is always written when the note or the buzzer has a duration,
+    /// since writing it restarts the duration.
+    /// @param driver Driver whose writeRegisters() does the write
+    /// @param registers Values of kSfeQwiicBuzzerRegToneFrequencyMsb to
+    /// kSfeQwiicBuzzerRegActive (see sfDevBuzzerNote)
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    template <class Driver> sfTkError_t writeNote(Driver &driver, const uint8_t *registers)
+    {
+        bool timed = registers[kDurationMsb] != 0 || registers[kDurationLsb] != 0;
+        return writeTimed(driver, kSfeQwiicBuzzerRegToneFrequencyMsb, registers, SFE_QWIIC_BUZZER_CACHED_REGISTERS,
+                          timed);
+    }
+
+    /// @brief Writes ACTIVE. Turning the buzzer on is always written when it
+    /// has a duration, since writing it restarts the duration.
+    /// @param driver Driver whose writeRegisters() does the write
+    /// @param active 1 to turn the buzzer on, 0 to turn it off
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    template <class Driver> sfTkError_t writeActive(Driver &driver, const uint8_t active)
+    {
+        if (active == 0)
+            return write(driver, kSfeQwiicBuzzerRegActive, &active, 1);
+
+        return writeTimed(driver, kSfeQwiicBuzzerRegActive, &active, 1, false);
+    }
+
+  private:
+    // Offsets of the duration registers in the cache
+    static const uint8_t kDurationMsb = kSfeQwiicBuzzerRegDurationMsb - kSfeQwiicBuzzerRegToneFrequencyMsb;
+    static const uint8_t kDurationLsb = kSfeQwiicBuzzerRegDurationLsb - kSfeQwiicBuzzerRegToneFrequencyMsb;
+
+    /// @brief Gets the valid bit of a register
+    /// @param devReg The register, in the cached range
+    /// @return The bit
+    static uint8_t registerBit(const uint8_t devReg)
+    {
+        return 1 << (devReg - kSfeQwiicBuzzerRegToneFrequencyMsb);
+    }
+
+    /// @brief Writes registers up to ACTIVE, forgetting ACTIVE before and after
+    /// the write if the buzzer may turn itself off
+    /// @param timed The values written set a duration
+    template <class Driver>
+    sfTkError_t writeTimed(Driver &driver, const uint8_t devReg, const uint8_t *data, const size_t length,
+                           const bool timed)
+    {
+        bool forget = timed || deviceTimed();
+        if (forget)
+            invalidateActive();
+
+        sfTkError_t err = write(driver, devReg, data, length);
+
+        if (forget)
+            invalidateActive();
+        return err;
+    }
+
+    uint8_t _values[SFE_QWIIC_BUZZER_CACHED_REGISTERS];
+    uint8_t _valid;
+};
@@ -0,0 +1,195 @@
+/**
+ * @file    sfDevBuzzerRtttl.cpp
+ * @brief   Implementation file for the RTTTL (ring tone text) melody parsers
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file contains the implementation of the runtime RTTTL parser.
+ *          The compile time parser is entirely in sfDevBuzzerRtttl.h.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerRtttl.h"
+
+sfDevBuzzerRtttlSource::sfDevBuzzerRtttlSource(const char *text) : _text{text}, _position{0}, _input{nullptr}
+{
+    rewind();
+}
+
+sfDevBuzzerRtttlSource::sfDevBuzzerRtttlSource(sfDevBuzzerMelodySource *input)
+    : _text{nullptr}, _position{0}, _input{input}
+{
+    rewind();
+}
+
+int16_t sfDevBuzzerRtttlSource::read()
+{
+    // Bytes of the last note that were not read yet
+    if (_outputNext < _outputCount)
+        return _output[_outputNext++];
+
+    while (_state != kEnded)
+    {
+        int16_t c = readChar();
+        if (c == SFE_QWIIC_BUZZER_MELODY_SOURCE_WAIT)
+            return SFE_QWIIC_BUZZER_MELODY_SOURCE_WAIT;
+
+        // The text ends with the string, or a new line
+        if (c < 0 || c == '\0' || c == '\n' || c == '\r')
+        {
+            bool emitted = _state == kNotes && emitNote();
+            _state = kEnded;
+            if (emitted)
+                return _output[_outputNext++];
+            break;
+        }
+
+        c = sfDevBuzzerRtttlParser::lower(c);
+        bool isDigit = sfDevBuzzerRtttlParser::isDigit(c);
+
+        switch (_state)
+        {
+        case kName:
+            if (c == ':')
+                _state = kDefaults;
+            break;
+
+        case kDefaults:
+            if (isDigit)
+            {
+                if (_value < 10000)
+                    _value = _value * 10 + (c - '0');
+            }
+            else if (c == ',' || c == ':')
+            {
+                // Apply the setting that just ended
+                if (_key == 'd')
+                    _defaultDuration = sfDevBuzzerRtttlParser::duration(_value > 0xFF ? 0xFF : _value,
+                                                                        SFE_QWIIC_BUZZER_RTTTL_DEFAULT_DURATION);
+                else if (_key == 'o')
+                    _defaultOctave = _value > 9 ? 9 : _value;
+                else if (_key == 'b')
+                    _wholeNoteMs = sfDevBuzzerRtttlParser::wholeNoteMs(_value);
+
+                _key = 0;
+                _value = 0;
+                if (c == ':')
+                    _state = kNotes;
+            }
+            else if (c >= 'a' && c <= 'z')
+                _key = c;
+            break;
+
+        case kNotes:
+            if (c == ',')
+            {
+                if (emitNote())
+                    return _output[_outputNext++];
+            }
+            else if (isDigit)
+            {
+                // Numbers before the letter are the duration, after it the octave
+                if (_value < 1000)
+                    _value = _value * 10 + (c - '0');
+                if (_letter == 0)
+                    _duration = _value > 0xFF ? 0xFF : _value;
+                else
+                    _hasOctave = true;
+            }
+            else if (c == '#')
+                _sharp = true;
+            else if (c == '.')
+                _dotted = true;
+            else if (c >= 'a' && c <= 'z' && _letter == 0)
+            {
+                _letter = c;
+                _value = 0;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return SFE_QWIIC_BUZZER_MELODY_SOURCE_END;
+}
+
+uint16_t sfDevBuzzerRtttlSource::wholeNoteMs()
+{
+    return _state == kNotes || _state == kEnded ? _wholeNoteMs : 0;
+}
+
+void sfDevBuzzerRtttlSource::rewind()
+{
+    _position = 0;
+    _state = kName;
+    _defaultDuration = SFE_QWIIC_BUZZER_RTTTL_DEFAULT_DURATION;
+    _defaultOctave = SFE_QWIIC_BUZZER_RTTTL_DEFAULT_OCTAVE;
+    _wholeNoteMs = sfDevBuzzerRtttlParser::wholeNoteMs(SFE_QWIIC_BUZZER_RTTTL_DEFAULT_BPM);
+    _key = 0;
+    _value = 0;
+    _lastDuration = 0xFF;
+    _outputCount = 0;
+    _outputNext = 0;
+    clearNote();
+}
+
+int16_t sfDevBuzzerRtttlSource::readChar()
+{
+    if (_input != nullptr)
+        return _input->read();
+
+    if (_text == nullptr || _text[_position] == '\0')
+        return SFE_QWIIC_BUZZER_MELODY_SOURCE_END;
+
+    return (uint8_t)_text[_position++];
+}
+
+bool sfDevBuzzerRtttlSource::emitNote()
+{
+    if (_letter == 0)
+    {
+        // Empty note, e.g. a trailing comma
+        clearNote();
+        return false;
+    }
+
+    uint8_t octave = _hasOctave ? (_value > 9 ? 9 : _value) : _defaultOctave;
+    uint8_t duration = sfDevBuzzerRtttlParser::duration(_duration, _defaultDuration);
+
+    uint8_t note = sfDevBuzzerRtttlParser::noteIndex(_letter, _sharp, octave);
+    uint8_t code = sfDevBuzzerRtttlParser::durationCode(duration, _dotted);
+
+    // Leave out the duration when it is the same as the previous note's
+    _outputNext = 0;
+    if (code == _lastDuration)
+    {
+        _output[0] = note | SFE_QWIIC_BUZZER_MELODY_SAME;
+        _outputCount = 1;
+    }
+    else
+    {
+        _output[0] = note;
+        _output[1] = code;
+        _outputCount = 2;
+        _lastDuration = code;
+    }
+
+    clearNote();
+    return true;
+}
+
+void sfDevBuzzerRtttlSource::clearNote()
+{
+    _letter = 0;
+    _duration = 0;
+    _sharp = false;
+    _dotted = false;
+    _hasOctave = false;
+    _value = 0;
+}
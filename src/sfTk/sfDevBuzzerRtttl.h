@@ -0,0 +1,471 @@
+/**
+ * @file    sfDevBuzzerRtttl.h
+ * @brief   Header file for the RTTTL (ring tone text) melody parsers
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares two parsers for melodies written as RTTTL text,
+ *          e.g. "Beep:d=4,o=5,b=120:8c6,8p,8c6". Both turn the text into the
+ *          packed melody format of sfDevBuzzerMelody.h, with the notes of
+ *          sfDevBuzzerPitches.h:
+ *
+ *          - SFE_QWIIC_BUZZER_RTTTL() parses a string literal at compile time.
+ *            The text is not stored in the program, only the packed melody (2
+ *            bytes per note), and nothing is parsed while the sketch runs.
+ *          - sfDevBuzzerRtttlSource parses text as the melody plays, e.g. a tune
+ *            received over a serial link.
+ *
+ *          RTTTL text is made of a name, the defaults (d = duration, o =
+ *          octave, b = beats per minute) and the notes, separated by colons.
+ *          Each note is [duration]letter[#][.][octave][.], where the letter is
+ *          a to g, or p for a rest. A duration of 0, in the defaults or for a
+ *          note, is taken as not given. Notes must be within B0 to D#8, the
+ *          range of the note table: SFE_QWIIC_BUZZER_RTTTL() rejects the
+ *          others, and sfDevBuzzerRtttlSource plays them as B0 or D#8.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzerMelody.h"
+
+// Defaults of the RTTTL specification, used when the text leaves them out
+#define SFE_QWIIC_BUZZER_RTTTL_DEFAULT_DURATION 4
+#define SFE_QWIIC_BUZZER_RTTTL_DEFAULT_OCTAVE 6
+#define SFE_QWIIC_BUZZER_RTTTL_DEFAULT_BPM 63
+
+/// @brief Declares a melody parsed from RTTTL text at compile time. Use it
+/// outside of functions. The melody is then available as name::data (in program
+/// memory), and its tempo as name::wholeNoteMs:
+///
+///     SFE_QWIIC_BUZZER_RTTTL(beep, "Beep:d=4,o=5,b=120:8c6,8p,8c6");
+///     sfDevBuzzerMelodyArray beepSource(beep::data, sizeof(beep::data));
+///     player.start(&buzzer, &beepSource, 4, beep::wholeNoteMs);
+/// @param name Name of the melody
+/// @param rtttl RTTTL text, a string literal
+#define SFE_QWIIC_BUZZER_RTTTL(name, rtttl)                                                                            \
+    struct name##RtttlText                                                                                             \
+    {                                                                                                                  \
+        static constexpr const char *str()                                                                             \
+        {                                                                                                              \
+            return rtttl;                                                                                              \
+        }                                                                                                              \
+        static constexpr size_t length()                                                                               \
+        {                                                                                                              \
+            return sizeof(rtttl) - 1;                                                                                  \
+        }                                                                                                              \
+    };                                                                                                                 \
+    typedef sfDevBuzzerRtttl<name##RtttlText> name
+
+/// @brief RTTTL parsing, usable in constant expressions. The compile time
+/// parser only uses functions with a single return statement (C++11), and
+/// splits the searches through the text in halves, to keep the recursion
+/// shallow enough for long melodies.
+class sfDevBuzzerRtttlParser
+{
+  public:
+    /// @brief Gets the character at a position, or 0 past the end
+    static constexpr char at(const char *s, const size_t p, const size_t end)
+    {
+        return p < end ? s[p] : '\0';
+    }
+
+    /// @brief Converts a letter to lower case
+    static constexpr char lower(const char c)
+    {
+        return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+    }
+
+    /// @brief Checks if a character is a digit
+    static constexpr bool isDigit(const char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    /// @brief Counts the occurrences of a character in s[lo, hi)
+    static constexpr size_t count(const char *s, const size_t lo, const size_t hi, const char c)
+    {
+        return hi - lo == 0   ? 0
+               : hi - lo == 1 ? (s[lo] == c ? 1 : 0)
+                              : count(s, lo, lo + (hi - lo) / 2, c) + count(s, lo + (hi - lo) / 2, hi, c);
+    }
+
+    /// @brief Finds the n-th (from 0) occurrence of a character in s[lo, hi)
+    /// @return Its position, or hi if there are not that many
+    static constexpr size_t find(const char *s, const size_t lo, const size_t hi, const char c, const size_t n)
+    {
+        return hi - lo == 0   ? hi
+               : hi - lo == 1 ? (s[lo] == c && n == 0 ? lo : hi)
+               : n < count(s, lo, lo + (hi - lo) / 2, c)
+                   ? find(s, lo, lo + (hi - lo) / 2, c, n)
+                   : find(s, lo + (hi - lo) / 2, hi, c, n - count(s, lo, lo + (hi - lo) / 2, c));
+    }
+
+    /// @brief Skips spaces
+    static constexpr size_t skipSpaces(const char *s, const size_t p, const size_t end)
+    {
+        return at(s, p, end) == ' ' ? skipSpaces(s, p + 1, end) : p;
+    }
+
+    /// @brief Finds the end of a number
+    static constexpr size_t digitsEnd(const char *s, const size_t p, const size_t end)
+    {
+        return isDigit(at(s, p, end)) ? digitsEnd(s, p + 1, end) : p;
+    }
+
+    /// @brief Reads a number
+    static constexpr unsigned number(const char *s, const size_t p, const size_t end, const unsigned value = 0)
+    {
+        return isDigit(at(s, p, end)) ? number(s, p + 1, end, value * 10 + (s[p] - '0')) : value;
+    }
+
+    /// @brief Gets a value of the defaults section, e.g. "d=4,o=5,b=120"
+    /// @param key 'd', 'o' or 'b'
+    /// @param value Value to use if the key is not found
+    static constexpr unsigned setting(const char *s, const size_t p, const size_t end, const char key,
+                                      const unsigned value)
+    {
+        return p >= end ? value
+               : lower(s[p]) == key && at(s, skipSpaces(s, p + 1, end), end) == '='
+                   ? number(s, skipSpaces(s, skipSpaces(s, p + 1, end) + 1, end), end)
+                   : setting(s, p + 1, end, key, value);
+    }
+
+    /// @brief Gets the semitone of a note letter, within its octave
+    /// @return 0 (C) to 11 (B), or 12 for rests and unknown letters
+    static constexpr uint8_t semitone(const char letter)
+    {
+        return letter == 'c'   ? 0
+               : letter == 'd' ? 2
+               : letter == 'e' ? 4
+               : letter == 'f' ? 5
+               : letter == 'g' ? 7
+               : letter == 'a' ? 9
+               : letter == 'b' ? 11
+                               : 12;
+    }
+
+    /// @brief Converts a note to its packed note index. Notes outside of B0 to
+    /// D#8 are clamped to that range.
+    /// @param letter Note letter, in lower case
+    /// @param sharp True if the note is followed by #
+    /// @param octave Octave of the note
+    /// @return Note index, SFE_QWIIC_BUZZER_MELODY_REST for rests
+    static constexpr uint8_t noteIndex(const char letter, const bool sharp, const unsigned octave)
+    {
+        return semitone(letter) > 11 ? SFE_QWIIC_BUZZER_MELODY_REST
+                                     : sfDevBuzzerNoteIndex(semitone(letter) + (sharp ? 1 : 0), octave > 9 ? 9 : octave);
+    }
+
+    /// @brief Checks if a note is in the note table (B0 to D#8), so that
+    /// noteIndex() doesn't clamp it
+    /// @param letter Note letter, in lower case
+    /// @param sharp True if the note is followed by #
+    /// @param octave Octave of the note
+    /// @return True for notes in the table, and for rests
+    static constexpr bool inTable(const char letter, const bool sharp, const unsigned octave)
+    {
+        return semitone(letter) > 11 || (octave <= 9 && octave * 12 + semitone(letter) + (sharp ? 1 : 0) >= 11 &&
+                                         octave * 12 + semitone(letter) + (sharp ? 1 : 0) <= 99);
+    }
+
+    /// @brief Gets the duration of a note. 0 is not an RTTTL duration, and is
+    /// taken as not given, both for "d=0" and for a note such as "0c".
+    /// @param value Duration in the text, 0 if there is none
+    /// @param defaultDuration Duration used instead
+    /// @return Duration (1, 2, 4... 32)
+    static constexpr unsigned duration(const unsigned value, const unsigned defaultDuration)
+    {
+        return value == 0 ? defaultDuration : value;
+    }
+
+    /// @brief Gets n for a note lasting 1/2^n of a whole note. Durations that
+    /// are not powers of two are rounded up.
+    static constexpr uint8_t exponent(const unsigned duration)
+    {
+        return duration <= 1 ? 0 : 1 + exponent((duration + 1) / 2);
+    }
+
+    /// @brief Converts an RTTTL duration (1, 2, 4... 32) to its packed duration code
+    static constexpr uint8_t durationCode(const unsigned duration, const bool dotted)
+    {
+        return (exponent(duration) > SFE_QWIIC_BUZZER_MELODY_SIXTY_FOURTH ? SFE_QWIIC_BUZZER_MELODY_SIXTY_FOURTH
+                                                                          : exponent(duration)) |
+               (dotted ? SFE_QWIIC_BUZZER_MELODY_DOTTED : 0);
+    }
+
+    /// @brief Gets the length of a whole note for a tempo. Notes are followed by
+    /// the gap of the melody player, so the whole note is shortened to keep the
+    /// tempo of the text.
+    /// @param bpm Beats (quarter notes) per minute
+    /// @return Length of a whole note in milliseconds
+    static constexpr uint16_t wholeNoteMs(const unsigned bpm)
+    {
+        return bpm == 0                         ? wholeNoteMs(SFE_QWIIC_BUZZER_RTTTL_DEFAULT_BPM)
+               : 2400000UL / (13UL * bpm) > 0xFFFF ? 0xFFFF
+                                                   : 2400000UL / (13UL * bpm);
+    }
+
+    // Sections of the text: name:defaults:notes
+
+    static constexpr size_t defaultsStart(const char *s, const size_t length)
+    {
+        return find(s, 0, length, ':', 0) + 1;
+    }
+
+    static constexpr size_t notesStart(const char *s, const size_t length)
+    {
+        return find(s, 0, length, ':', 1) + 1;
+    }
+
+    static constexpr unsigned defaultSetting(const char *s, const size_t length, const char key, const unsigned value)
+    {
+        return setting(s, defaultsStart(s, length), notesStart(s, length) - 1, key, value);
+    }
+
+    /// @brief Checks if the text has the three sections
+    static constexpr bool isValid(const char *s, const size_t length)
+    {
+        return count(s, 0, length, ':') == 2;
+    }
+
+    /// @brief Gets the number of notes (and rests) in the text
+    static constexpr size_t eventCount(const char *s, const size_t length)
+    {
+        return !isValid(s, length) || skipSpaces(s, notesStart(s, length), length) >= length
+                   ? 0
+                   : count(s, notesStart(s, length), length, ',') + 1;
+    }
+
+    // Parsing of a note in s[start, end)
+
+    static constexpr size_t letterAt(const char *s, const size_t start, const size_t end)
+    {
+        return digitsEnd(s, skipSpaces(s, start, end), end);
+    }
+
+    static constexpr bool isSharp(const char *s, const size_t start, const size_t end)
+    {
+        return at(s, letterAt(s, start, end) + 1, end) == '#';
+    }
+
+    static constexpr size_t octaveAt(const char *s, const size_t start, const size_t end)
+    {
+        return letterAt(s, start, end) + (isSharp(s, start, end) ? 2 : 1) +
+               (at(s, letterAt(s, start, end) + (isSharp(s, start, end) ? 2 : 1), end) == '.' ? 1 : 0);
+    }
+
+    static constexpr unsigned noteOctave(const char *s, const size_t start, const size_t end, const unsigned octave)
+    {
+        return digitsEnd(s, octaveAt(s, start, end), end) > octaveAt(s, start, end)
+                   ? number(s, octaveAt(s, start, end), end)
+                   : octave;
+    }
+
+    static constexpr uint8_t noteByte(const char *s, const size_t start, const size_t end, const unsigned octave)
+    {
+        return noteIndex(lower(at(s, letterAt(s, start, end), end)), isSharp(s, start, end),
+                         noteOctave(s, start, end, octave));
+    }
+
+    static constexpr bool noteInTable(const char *s, const size_t start, const size_t end, const unsigned octave)
+    {
+        return inTable(lower(at(s, letterAt(s, start, end), end)), isSharp(s, start, end),
+                       noteOctave(s, start, end, octave));
+    }
+
+    static constexpr uint8_t durationByte(const char *s, const size_t start, const size_t end,
+                                          const unsigned defaultDuration)
+    {
+        return durationCode(
+            duration(letterAt(s, start, end) > skipSpaces(s, start, end) ? number(s, skipSpaces(s, start, end), end) : 0,
+                     defaultDuration),
+            at(s, octaveAt(s, start, end) - 1, end) == '.' ||
+                at(s, digitsEnd(s, octaveAt(s, start, end), end), end) == '.');
+    }
+
+    // Bounds of the i-th note
+
+    static constexpr size_t eventStart(const char *s, const size_t length, const size_t i)
+    {
+        return i == 0 ? notesStart(s, length) : find(s, notesStart(s, length), length, ',', i - 1) + 1;
+    }
+
+    static constexpr size_t eventEnd(const char *s, const size_t length, const size_t i)
+    {
+        return find(s, notesStart(s, length), length, ',', i);
+    }
+
+    static constexpr unsigned defaultOctave(const char *s, const size_t length)
+    {
+        return defaultSetting(s, length, 'o', SFE_QWIIC_BUZZER_RTTTL_DEFAULT_OCTAVE);
+    }
+
+    static constexpr unsigned defaultDuration(const char *s, const size_t length)
+    {
+        return duration(defaultSetting(s, length, 'd', 0), SFE_QWIIC_BUZZER_RTTTL_DEFAULT_DURATION);
+    }
+
+    /// @brief Gets the k-th byte of the packed melody: 2 bytes per note, then
+    /// SFE_QWIIC_BUZZER_MELODY_END
+    static constexpr uint8_t packedByte(const char *s, const size_t length, const size_t k)
+    {
+        return k >= 2 * eventCount(s, length) ? SFE_QWIIC_BUZZER_MELODY_END
+               : k % 2 == 0 ? noteByte(s, eventStart(s, length, k / 2), eventEnd(s, length, k / 2),
+                                       defaultOctave(s, length))
+                            : durationByte(s, eventStart(s, length, k / 2), eventEnd(s, length, k / 2),
+                                           defaultDuration(s, length));
+    }
+
+    /// @brief Checks that the notes lo to hi - 1 are all in the note table,
+    /// splitting the range in halves like count()
+    static constexpr bool notesInTable(const char *s, const size_t length, const size_t lo, const size_t hi)
+    {
+        return hi - lo == 0 ? true
+               : hi - lo == 1
+                   ? noteInTable(s, eventStart(s, length, lo), eventEnd(s, length, lo), defaultOctave(s, length))
+                   : notesInTable(s, length, lo, lo + (hi - lo) / 2) && notesInTable(s, length, lo + (hi - lo) / 2, hi);
+    }
+};
+
+/// @brief A list of indices, to expand the packed melody byte by byte
+template <size_t... I> struct sfDevBuzzerIndices
+{
+};
+
+/// @brief Doubles a list of indices 0 to N-1, adding one more if Odd
+template <typename Half, bool Odd> struct sfDevBuzzerDoubleIndices;
+
+template <size_t... I> struct sfDevBuzzerDoubleIndices<sfDevBuzzerIndices<I...>, false>
+{
+    typedef sfDevBuzzerIndices<I..., (sizeof...(I) + I)...> type;
+};
+
+template <size_t... I> struct sfDevBuzzerDoubleIndices<sfDevBuzzerIndices<I...>, true>
+{
+    typedef sfDevBuzzerIndices<I..., (sizeof...(I) + I)..., 2 * sizeof...(I)> type;
+};
+
+/// @brief Builds sfDevBuzzerIndices<0, ..., N-1>, doubling the list at each
+/// step so that long melodies don't exceed the template depth
+template <size_t N> struct sfDevBuzzerMakeIndices
+{
+    typedef typename sfDevBuzzerDoubleIndices<typename sfDevBuzzerMakeIndices<N / 2>::type, N % 2 == 1>::type type;
+};
+
+template <> struct sfDevBuzzerMakeIndices<0>
+{
+    typedef sfDevBuzzerIndices<> type;
+};
+
+/// @brief Packed melody bytes of an RTTTL text
+template <typename Text, typename Indices> class sfDevBuzzerRtttlData;
+
+template <typename Text, size_t... I> class sfDevBuzzerRtttlData<Text, sfDevBuzzerIndices<I...>>
+{
+  public:
+    /// @brief The packed melody, in program memory
+    static constexpr uint8_t data[sizeof...(I)] SFE_QWIIC_BUZZER_PROGMEM = {
+        sfDevBuzzerRtttlParser::packedByte(Text::str(), Text::length(), I)...};
+};
+
+template <typename Text, size_t... I>
+constexpr uint8_t sfDevBuzzerRtttlData<Text, sfDevBuzzerIndices<I...>>::data[sizeof...(I)];
+
+/// @brief A melody parsed from RTTTL text at compile time, declared with
+/// SFE_QWIIC_BUZZER_RTTTL()
+template <typename Text>
+class sfDevBuzzerRtttl
+    : public sfDevBuzzerRtttlData<Text, typename sfDevBuzzerMakeIndices<
+                                            2 * sfDevBuzzerRtttlParser::eventCount(Text::str(), Text::length()) + 1>::type>
+{
+    static_assert(sfDevBuzzerRtttlParser::isValid(Text::str(), Text::length()),
+                  "RTTTL text must be name:defaults:notes");
+    static_assert(sfDevBuzzerRtttlParser::notesInTable(Text::str(), Text::length(), 0,
+                                                       sfDevBuzzerRtttlParser::eventCount(Text::str(), Text::length())),
+                  "RTTTL notes must be within B0 to D#8");
+
+  public:
+    /// @brief Number of notes and rests
+    static constexpr size_t eventCount = sfDevBuzzerRtttlParser::eventCount(Text::str(), Text::length());
+
+    /// @brief Length of a whole note in milliseconds, for sfDevBuzzerMelodyPlayer::start()
+    static constexpr uint16_t wholeNoteMs = sfDevBuzzerRtttlParser::wholeNoteMs(
+        sfDevBuzzerRtttlParser::defaultSetting(Text::str(), Text::length(), 'b', SFE_QWIIC_BUZZER_RTTTL_DEFAULT_BPM));
+};
+
+/// @brief Parses RTTTL text while the melody plays, and hands it to the melody
+/// player in the packed format. Uses a few bytes of RAM, whatever the length of
+/// the text. The tempo of the text is used instead of the one given to the
+/// player. Notes outside of B0 to D#8 can't be rejected as they arrive, and
+/// are played as B0 or D#8.
+class sfDevBuzzerRtttlSource : public sfDevBuzzerMelodySource
+{
+  public:
+    /// @brief Constructor, to parse a string in RAM
+    /// @param text RTTTL text, ending with a null character
+    sfDevBuzzerRtttlSource(const char *text);
+
+    /// @brief Constructor, to parse text read from another source one character
+    /// at a time, e.g. QwiicBuzzerMelodyStream. The text ends with a new line.
+    /// @param input Where to read the text from
+    sfDevBuzzerRtttlSource(sfDevBuzzerMelodySource *input);
+
+    /// @brief Reads the next byte of the packed melody
+    /// @return The byte, SFE_QWIIC_BUZZER_MELODY_SOURCE_END at the end of the
+    /// text, or SFE_QWIIC_BUZZER_MELODY_SOURCE_WAIT if the input is waiting
+    /// for more text
+    int16_t read();
+
+    /// @brief Gets the length of a whole note, from the tempo of the text
+    /// @return Length in milliseconds, 0 until the defaults have been parsed
+    uint16_t wholeNoteMs();
+
+    /// @brief Goes back to the start of the text
+    void rewind();
+
+  private:
+    /// @brief Parser states, one per section of the text
+    enum State : uint8_t
+    {
+        kName,
+        kDefaults,
+        kNotes,
+        kEnded
+    };
+
+    /// @brief Reads the next character of the text
+    int16_t readChar();
+
+    /// @brief Turns the note parsed so far into packed bytes
+    /// @return True if there was a note
+    bool emitNote();
+
+    /// @brief Clears the note being parsed
+    void clearNote();
+
+    const char *_text;
+    size_t _position;
+    sfDevBuzzerMelodySource *_input;
+
+    State _state;
+    uint8_t _defaultDuration;
+    uint8_t _defaultOctave;
+    uint16_t _wholeNoteMs;
+    char _key;       // default being parsed
+    uint16_t _value; // number being parsed
+
+    char _letter; // note being parsed, 0 until its letter is read
+    uint8_t _duration;
+    bool _sharp;
+    bool _dotted;
+    bool _hasOctave;
+    uint8_t _lastDuration;
+
+    uint8_t _output[2];
+    uint8_t _outputCount;
+    uint8_t _outputNext;
+};
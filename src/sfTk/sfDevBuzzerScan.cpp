@@ -0,0 +1,94 @@
+/**
+ * @file    sfDevBuzzerScan.cpp
+ * @brief   Implementation file for finding Qwiic Buzzers on an I2C bus
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file contains the implementation of the bus scan functions.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerScan.h"
+
+#include <string.h>
+
+sfDevBuzzerAddressSet::sfDevBuzzerAddressSet() : _bits{}
+{
+}
+
+void sfDevBuzzerAddressSet::add(const uint8_t address)
+{
+    if (address < 128)
+        _bits[address >> 3] |= 1 << (address & 0x07);
+}
+
+void sfDevBuzzerAddressSet::remove(const uint8_t address)
+{
+    if (address < 128)
+        _bits[address >> 3] &= ~(1 << (address & 0x07));
+}
+
+bool sfDevBuzzerAddressSet::contains(const uint8_t address) const
+{
+    if (address >= 128)
+        return false;
+
+    return _bits[address >> 3] & (1 << (address & 0x07));
+}
+
+void sfDevBuzzerAddressSet::clear()
+{
+    memset(_bits, 0, sizeof(_bits));
+}
+
+uint8_t sfDevBuzzerScanNext(sfTkII2C *bus, const uint8_t start, const sfDevBuzzerAddressSet *exclude)
+{
+    if (bus == nullptr)
+        return 0;
+
+    uint8_t original = bus->address();
+    uint8_t found = 0;
+
+    for (uint8_t address = start < SFE_QWIIC_BUZZER_ADDRESS_MIN ? SFE_QWIIC_BUZZER_ADDRESS_MIN : start;
+         address <= SFE_QWIIC_BUZZER_ADDRESS_MAX; address++)
+    {
+        if (exclude != nullptr && exclude->contains(address))
+            continue;
+
+        // The ID read doubles as the ping: without a device, it ends at the
+        // address byte
+        bus->setAddress(address);
+        uint8_t deviceId;
+        if (bus->readRegister(kSfeQwiicBuzzerRegId, deviceId) == ksfTkErrOk && deviceId == SFE_QWIIC_BUZZER_DEVICE_ID)
+        {
+            found = address;
+            break;
+        }
+    }
+
+    bus->setAddress(original);
+    return found;
+}
+
+uint8_t sfDevBuzzerScan(sfTkII2C *bus, uint8_t *addresses, const uint8_t maxCount,
+                        const sfDevBuzzerAddressSet *exclude)
+{
+    if (addresses == nullptr)
+        return 0;
+
+    uint8_t count = 0;
+    uint8_t address = SFE_QWIIC_BUZZER_ADDRESS_MIN;
+    while (count < maxCount)
+    {
+        address = sfDevBuzzerScanNext(bus, address, exclude);
+        if (address == 0)
+            break;
+
+        addresses[count++] = address++;
+    }
+    return count;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file    sfDevBuzzerScan.h
+ * @brief   Header file for finding Qwiic Buzzers on an I2C bus
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares functions to find every Qwiic Buzzer on a bus,
+ *          whatever its address. Each address from 0x08 to 0x77 is probed with
+ *          a read of the device ID register: an address with no device fails
+ *          right after the address byte, so the probe costs no more than a
+ *          ping, and a device that answers is verified by the same
+ *          transaction. Addresses known to belong to other devices can be
+ *          skipped with an sfDevBuzzerAddressSet.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzer.h"
+
+// Range of valid 7-bit I2C addresses
+#define SFE_QWIIC_BUZZER_ADDRESS_MIN 0x08
+#define SFE_QWIIC_BUZZER_ADDRESS_MAX 0x77
+
+/// @brief A set of I2C addresses, one bit per address
+class sfDevBuzzerAddressSet
+{
+  public:
+    /// @brief Default constructor, the set is empty
+    sfDevBuzzerAddressSet();
+
+    /// @brief Adds an address to the set
+    /// @param address 7-bit address
+    void add(const uint8_t address);
+
+    /// @brief Removes an address from the set
+    /// @param address 7-bit address
+    void remove(const uint8_t address);
+
+    /// @brief Checks if an address is in the set
+    /// @param address 7-bit address
+    /// @return True if it is in the set, false otherwise
+    bool contains(const uint8_t address) const;
+
+    /// @brief Removes all addresses from the set
+    void clear();
+
+  private:
+    uint8_t _bits[16];
+};
+
+/// @brief Finds the next Qwiic Buzzer on a bus. The address of the bus is
+/// restored before returning.
+/// @param bus The bus to scan
+/// @param start First address to probe
+/// @param exclude Addresses not to probe, nullptr for none
+/// @return Address of the buzzer found, or 0 if there are no more
+uint8_t sfDevBuzzerScanNext(sfTkII2C *bus, const uint8_t start = SFE_QWIIC_BUZZER_ADDRESS_MIN,
+                            const sfDevBuzzerAddressSet *exclude = nullptr);
+
+/// @brief Finds all the Qwiic Buzzers on a bus, with one transaction per
+/// address probed. The address of the bus is restored before returning.
+/// @param bus The bus to scan
+/// @param addresses Where the addresses of the buzzers found are stored
+/// @param maxCount Size of addresses, the scan stops when it is full
+/// @param exclude Addresses not to probe, nullptr for none
+/// @return Number of buzzers found
+uint8_t sfDevBuzzerScan(sfTkII2C *bus, uint8_t *addresses, const uint8_t maxCount,
+                        const sfDevBuzzerAddressSet *exclude = nullptr);
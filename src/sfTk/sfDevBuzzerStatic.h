@@ -0,0 +1,224 @@
+/**
+ * @file    sfDevBuzzerStatic.h
+ * @brief   Header file for a Qwiic Buzzer driver bound to its bus type at compile time
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file defines the sfDevBuzzerT class template, a lean driver for
+ *          the tone registers of the Qwiic Buzzer: play(), on(), off(),
+ *          configureBuzzer() and isActive(), through the same register cache
+ *          as sfDevBuzzer (sfDevBuzzerRegisterCache). Its bus calls name the
+ *          concrete bus class (e.g. sfTkArdI2C), so they are bound at compile
+ *          time and can be inlined, instead of going through the virtual
+ *          functions of sfTkII2C.
+ *
+ *          The address of the buzzer can also be fixed at compile time. The
+ *          buzzer then sets it on the bus before each transaction, so any
+ *          number of buzzers can share a single bus object.
+ *
+ *          Sound effects, retries, saving settings and the other features of
+ *          sfDevBuzzer are not included: use sfDevBuzzer (or QwiicBuzzer) for
+ *          those. Each driver keeps its own register cache, so a buzzer must
+ *          only be driven by one of them.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzer.h"
+
+/// @brief Qwiic Buzzer driver bound to a bus class at compile time
+/// @tparam Bus Concrete bus class, e.g. sfTkArdI2C. It must implement
+/// writeRegister() and readRegister() itself: the abstract sfTkII2C can't be
+/// used here, use sfDevBuzzer instead.
+/// @tparam Address 7-bit address of the buzzer, set on the bus before each
+/// transaction. 0 to use the address of the bus as it is.
+template <class Bus, uint8_t Address = 0> class sfDevBuzzerT
+{
+  public:
+    /// @brief Default constructor
+    sfDevBuzzerT() : _theBus{nullptr}, _registerCache{}
+    {
+    }
+
+    /// @brief Begins the Qwiic Buzzer
+    /// @param theBus I2C bus to use for communication
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t begin(Bus *theBus)
+    {
+        // Nullptr check
+        if (theBus == nullptr)
+            return ksfTkErrFail;
+
+        // Set bus pointer
+        _theBus = theBus;
+
+        // Nothing is known about the registers of this device yet
+        invalidateCache();
+
+        sfTkError_t err = isConnected();
+        // Check whether the ping was successful
+        if (err != ksfTkErrOk)
+            return err;
+
+        uint8_t readDeviceId;
+        err = deviceId(readDeviceId);
+        // Check whether the read was successful
+        if (err != ksfTkErrOk)
+            return err;
+
+        // check that device ID matches
+        if (readDeviceId != SFE_QWIIC_BUZZER_DEVICE_ID)
+            return ksfTkErrFail;
+
+        // Done!
+        return ksfTkErrOk;
+    }
+
+    /// @brief Checks if the Qwiic Buzzer is connected
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t isConnected()
+    {
+        selectAddress();
+        return _theBus->Bus::ping();
+    }
+
+    /// @brief Reads the Device ID of the Qwiic Buzzer
+    /// @param deviceId uint8_t variable where the read results will be stored
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t deviceId(uint8_t &deviceId)
+    {
+        return readRegisters(kSfeQwiicBuzzerRegId, &deviceId, 1);
+    }
+
+    /// @brief Configures the Qwiic Buzzer without causing the buzzer to buzz.
+    /// Only the registers that changed are written.
+    /// @param toneFrequency Frequency in Hz of buzzer tone
+    /// @param duration Duration in milliseconds (0 = forever)
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t configureBuzzer(const uint16_t toneFrequency = SFE_QWIIC_BUZZER_RESONANT_FREQUENCY,
+                                const uint16_t duration = 0, const uint8_t volume = 4)
+    {
+        sfDevBuzzerNote note;
+        sfDevBuzzer::makeNote(note, toneFrequency, duration, volume);
+
+        // The same registers as a note, but ACTIVE
+        return _registerCache.write(*this, kSfeQwiicBuzzerRegToneFrequencyMsb, note.registers,
+                                    SFE_QWIIC_BUZZER_CACHED_REGISTERS - 1);
+    }
+
+    /// @brief Configures the Qwiic Buzzer and turns it on, in a single I2C
+    /// transaction
+    /// @param toneFrequency Frequency in Hz of buzzer tone
+    /// @param duration Duration in milliseconds (0 = forever)
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t play(const uint16_t toneFrequency = SFE_QWIIC_BUZZER_RESONANT_FREQUENCY, const uint16_t duration = 0,
+                     const uint8_t volume = 4)
+    {
+        sfDevBuzzerNote note;
+        sfDevBuzzer::makeNote(note, toneFrequency, duration, volume);
+        return play(note);
+    }
+
+    /// @brief Plays a note prepared with sfDevBuzzer::makeNote(), in a single
+    /// I2C transaction
+    /// @param note The note
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t play(const sfDevBuzzerNote &note)
+    {
+        return _registerCache.writeNote(*this, note.registers);
+    }
+
+    /// @brief Turns on buzzer. Nothing is written if the buzzer is already on
+    /// with no duration set.
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t on()
+    {
+        return _registerCache.writeActive(*this, 1);
+    }
+
+    /// @brief Turns off buzzer
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t off()
+    {
+        return _registerCache.writeActive(*this, 0);
+    }
+
+    /// @brief Reads whether the buzzer is buzzing
+    /// @param active Variable where the read results will be stored
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t isActive(bool &active)
+    {
+        uint8_t value;
+        sfTkError_t err = readRegisters(kSfeQwiicBuzzerRegActive, &value, 1);
+        // Check whether the read was successful
+        if (err != ksfTkErrOk)
+            return err;
+
+        active = value != 0;
+        return ksfTkErrOk;
+    }
+
+    /// @brief Forgets the cached register values, see sfDevBuzzer::invalidateCache()
+    void invalidateCache()
+    {
+        _registerCache.invalidate();
+    }
+
+    /// @brief Gets the I2C address of the Qwiic Buzzer
+    /// @return The I2C address, 7-bit unshifted
+    uint8_t address()
+    {
+        return Address != 0 ? Address : _theBus->Bus::address();
+    }
+
+  private:
+    // The register cache writes through writeRegisters()
+    friend class sfDevBuzzerRegisterCache;
+
+    /// @brief Points the bus at this buzzer, if its address is fixed
+    void selectAddress()
+    {
+        if (Address != 0)
+            _theBus->Bus::setAddress(Address);
+    }
+
+    /// @brief Reads registers, in a single transaction
+    /// @param devReg First register
+    /// @param data Buffer for the values
+    /// @param length Number of registers
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t readRegisters(uint8_t devReg, uint8_t *data, const size_t length)
+    {
+        selectAddress();
+
+        size_t readBytes = 0;
+        sfTkError_t err = _theBus->Bus::readRegister(&devReg, 1, data, length, readBytes, 0);
+
+        // A short read is as bad as a failed one
+        if (err == ksfTkErrOk && readBytes != length)
+            return ksfTkErrFail;
+        return err;
+    }
+
+    /// @brief Writes registers, in a single transaction
+    /// @param devReg First register
+    /// @param data Values of the registers
+    /// @param length Number of registers
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t writeRegisters(uint8_t devReg, const uint8_t *data, const size_t length)
+    {
+        selectAddress();
+        return _theBus->Bus::writeRegister(&devReg, 1, data, length);
+    }
+
+    Bus *_theBus;
+
+    // Last values written to the tone, volume, duration and ACTIVE registers
+    sfDevBuzzerRegisterCache _registerCache;
+};
@@ -0,0 +1,44 @@
+/**
+ * @file    sfDevBuzzerTiming.cpp
+ * @brief   Implementation file for the step scheduling of the Qwiic Buzzer library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file contains the implementation of the step scheduler.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerTiming.h"
+
+void sfDevBuzzerScheduleStep(sfDevBuzzerTimingStats &stats, uint32_t &dueMs, const uint32_t nowMs,
+                             const uint32_t periodMs)
+{
+    // A step played early (a caller polling with a coarse clock) counts as on time
+    int32_t late = (int32_t)(nowMs - dueMs);
+    uint32_t lateMs = late > 0 ? late : 0;
+
+    uint32_t change = lateMs > stats.lastLateMs ? lateMs - stats.lastLateMs : stats.lastLateMs - lateMs;
+    if (stats.steps > 0 && change > stats.jitterMs)
+        stats.jitterMs = change;
+
+    stats.steps++;
+    if (lateMs > 0)
+        stats.lateSteps++;
+    stats.totalLateMs += lateMs;
+    if (lateMs > stats.maxLateMs)
+        stats.maxLateMs = lateMs;
+    stats.lastLateMs = lateMs;
+
+    // Too late to catch up, start the schedule again from this step
+    if (lateMs > SFE_QWIIC_BUZZER_RESYNC_MS)
+    {
+        stats.resyncs++;
+        dueMs = nowMs;
+    }
+
+    dueMs += periodMs;
+}
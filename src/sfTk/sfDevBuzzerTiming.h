@@ -0,0 +1,69 @@
+/**
+ * @file    sfDevBuzzerTiming.h
+ * @brief   Header file for the step scheduling of the Qwiic Buzzer library
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares how the steps of sound effects, glides and
+ *          melodies are scheduled. Each step is due at an absolute time: the
+ *          time the previous step was due, plus its length. The time spent on
+ *          the bus and in the sketch between two steps is then taken out of
+ *          the wait, rather than added to it, so a long effect or melody does
+ *          not drift, however slow the bus is.
+ *
+ *          A step played late is counted in sfDevBuzzerTimingStats, along with
+ *          how late it was. The following steps try to catch up, unless a step
+ *          is more than SFE_QWIIC_BUZZER_RESYNC_MS late (e.g. update() was not
+ *          called for a while): the schedule then starts again from that step,
+ *          rather than rushing through the steps missed.
+ *
+ *          Blocking calls read the time and sleep through an sfDevBuzzerClock,
+ *          sftk_ticks_ms() and sftk_delay_ms() unless another clock is given.
+ *          A simulated clock (e.g. sfDevBuzzerMockClock) lets a host test play
+ *          every sound effect in a few milliseconds of real time.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Lateness (ms) of a step beyond which the schedule starts again from it,
+// instead of catching up
+#define SFE_QWIIC_BUZZER_RESYNC_MS 100
+
+/// @brief How well the steps kept to their schedule
+struct sfDevBuzzerTimingStats
+{
+    uint32_t steps;       ///< Steps played
+    uint32_t lateSteps;   ///< Steps played 1ms or more after they were due
+    uint32_t totalLateMs; ///< Sum of the lateness of all steps, divide by steps for the mean
+    uint32_t maxLateMs;   ///< Lateness of the latest step
+    uint32_t jitterMs;    ///< Largest change of lateness between two steps in a row
+    uint32_t lastLateMs;  ///< Lateness of the last step
+    uint32_t resyncs;     ///< Times the schedule started again after a step more than SFE_QWIIC_BUZZER_RESYNC_MS late
+};
+
+/// @brief Where blocking calls read the time and sleep
+class sfDevBuzzerClock
+{
+  public:
+    /// @brief Gets the current time
+    /// @return Time in milliseconds
+    virtual uint32_t ticksMs() = 0;
+
+    /// @brief Waits, or lets simulated time pass
+    /// @param ms Number of milliseconds
+    virtual void delayMs(const uint32_t ms) = 0;
+};
+
+/// @brief Counts a step in the timing statistics, and schedules the next one
+/// @param stats The statistics to update
+/// @param dueMs Time the step was due, replaced by the time the next step is due
+/// @param nowMs Time the step was played
+/// @param periodMs Time from this step to the next one
+void sfDevBuzzerScheduleStep(sfDevBuzzerTimingStats &stats, uint32_t &dueMs, const uint32_t nowMs,
+                             const uint32_t periodMs);
@@ -0,0 +1,232 @@
+/**
+ * @file    sfDevBuzzerTuning.h
+ * @brief   Header file for the pitch tables of the Qwiic Buzzer library, indexed by MIDI note number
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file generates equal temperament pitch tables when the sketch
+ *          is compiled. sfDevBuzzerMidiFrequency() works out the frequency of
+ *          a MIDI note number (60 = middle C) for any tuning of A4, in integer
+ *          arithmetic so that every compiler gets the same result, and
+ *          sfDevBuzzerTuning<A4Hz>::pitches holds all 128 notes of a tuning,
+ *          already split into the big-endian bytes of the tone registers.
+ *          Transposing is adding to the note number, and a note is found
+ *          with a single table read.
+ *
+ *          The frequencies of sfDevBuzzerPitches.h are checked against the
+ *          generated ones at compile time. They are the same, but for
+ *          SFE_QWIIC_BUZZER_NOTE_FS2: 93Hz, where equal temperament gives
+ *          92.4986Hz.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzerEffects.h"
+#include "sfDevBuzzerPitches.h"
+
+#include <stdint.h>
+
+#define SFE_QWIIC_BUZZER_MIDI_NOTE_COUNT 128
+
+// Standard tuning, frequency of A4 in Hz
+#define SFE_QWIIC_BUZZER_TUNING_A4 440
+
+/// @brief Frequency of a note, as written to kSfeQwiicBuzzerRegToneFrequencyMsb
+/// and kSfeQwiicBuzzerRegToneFrequencyLsb
+struct sfDevBuzzerPitch
+{
+    uint8_t msb; ///< Frequency in Hz, high byte
+    uint8_t lsb; ///< Frequency in Hz, low byte
+};
+
+/// @brief Gets 2^(semitone/12), in fixed point with 28 fractional bits
+/// @param semitone Semitone within the octave, 0 to 11
+/// @return The ratio, rounded at each semitone
+constexpr uint64_t sfDevBuzzerSemitoneRatio(const uint8_t semitone)
+{
+    // 2^(1/12) * 2^28 = 284397458.85
+    return semitone == 0 ? (uint64_t)1 << 28 : (sfDevBuzzerSemitoneRatio(semitone - 1) * 284397459 + (1 << 27)) >> 28;
+}
+
+/// @brief Shifts the frequency of A4 in the octave of a note, and rounds it
+/// @param scaled Frequency of A4 in Hz, times the semitone ratio
+/// @param shift 28, minus the octave of the note relative to A4
+/// @return Frequency in Hz, rounded to the nearest
+constexpr uint16_t sfDevBuzzerRoundFrequency(const uint64_t scaled, const uint8_t shift)
+{
+    return (uint16_t)((scaled + ((uint64_t)1 << (shift - 1))) >> shift);
+}
+
+/// @brief Gets the equal temperament frequency of a MIDI note, at compile
+/// time (e.g. in a static_assert) or run time
+/// @param midiNote MIDI note number, 0 to 127 (60 = middle C, 69 = A4)
+/// @param a4Hz Frequency of A4 in Hz, e.g. 440, 432 or 415
+/// @return Frequency in Hz, rounded to the nearest
+constexpr uint16_t sfDevBuzzerMidiFrequency(const uint8_t midiNote, const uint16_t a4Hz = SFE_QWIIC_BUZZER_TUNING_A4)
+{
+    // 51 semitones below A4 is A(-1), so (midiNote + 51) / 12 - 10 is the
+    // octave relative to A4, and the remainder the semitone above A
+    return sfDevBuzzerRoundFrequency(a4Hz * sfDevBuzzerSemitoneRatio((midiNote + 51) % 12),
+                                     28 + 10 - (midiNote + 51) / 12);
+}
+
+/// @brief Transposes a MIDI note, keeping it in range
+/// @param midiNote MIDI note number
+/// @param semitones Number of semitones, negative to go down
+/// @return MIDI note number, 0 to 127
+constexpr uint8_t sfDevBuzzerTranspose(const uint8_t midiNote, const int8_t semitones)
+{
+    return midiNote + semitones < 0 ? 0
+           : midiNote + semitones >= SFE_QWIIC_BUZZER_MIDI_NOTE_COUNT
+               ? SFE_QWIIC_BUZZER_MIDI_NOTE_COUNT - 1
+               : midiNote + semitones;
+}
+
+/// @brief MIDI note numbers 0 to N - 1, to generate the tables
+template <uint8_t... Notes> struct sfDevBuzzerMidiNotes
+{
+};
+
+template <uint8_t N, uint8_t... Notes> struct sfDevBuzzerMakeMidiNotes : sfDevBuzzerMakeMidiNotes<N - 1, N - 1, Notes...>
+{
+};
+
+template <uint8_t... Notes> struct sfDevBuzzerMakeMidiNotes<0, Notes...>
+{
+    typedef sfDevBuzzerMidiNotes<Notes...> type;
+};
+
+/// @brief Pitch table of a tuning, stored in program memory. Only the tunings
+/// a sketch uses are compiled, 256 bytes each.
+/// @tparam A4Hz Frequency of A4 in Hz
+template <uint16_t A4Hz, class Notes = typename sfDevBuzzerMakeMidiNotes<SFE_QWIIC_BUZZER_MIDI_NOTE_COUNT>::type>
+struct sfDevBuzzerTuning;
+
+template <uint16_t A4Hz, uint8_t... Notes> struct sfDevBuzzerTuning<A4Hz, sfDevBuzzerMidiNotes<Notes...>>
+{
+    /// @brief Pitches of MIDI notes 0 to 127, read them with sfDevBuzzerReadPitch()
+    static const sfDevBuzzerPitch pitches[SFE_QWIIC_BUZZER_MIDI_NOTE_COUNT];
+};
+
+template <uint16_t A4Hz, uint8_t... Notes>
+const sfDevBuzzerPitch sfDevBuzzerTuning<A4Hz, sfDevBuzzerMidiNotes<Notes...>>::pitches[SFE_QWIIC_BUZZER_MIDI_NOTE_COUNT]
+    SFE_QWIIC_BUZZER_PROGMEM = {{(uint8_t)(sfDevBuzzerMidiFrequency(Notes, A4Hz) >> 8),
+                                 (uint8_t)(sfDevBuzzerMidiFrequency(Notes, A4Hz) & 0xFF)}...};
+
+/// @brief Pitch table of the standard tuning, A4 = 440Hz
+typedef sfDevBuzzerTuning<SFE_QWIIC_BUZZER_TUNING_A4> sfDevBuzzerStandardTuning;
+
+/// @brief Reads a note from a pitch table
+/// @param pitches The table, e.g. sfDevBuzzerStandardTuning::pitches
+/// @param midiNote MIDI note number, 0 to 127
+/// @return The pitch
+inline sfDevBuzzerPitch sfDevBuzzerReadPitch(const sfDevBuzzerPitch *pitches, const uint8_t midiNote)
+{
+    sfDevBuzzerPitch pitch;
+    sfDevBuzzerReadProgmem(&pitch, &pitches[midiNote < SFE_QWIIC_BUZZER_MIDI_NOTE_COUNT ? midiNote : 127],
+                           sizeof(pitch));
+    return pitch;
+}
+
+// The note definitions are within 1Hz of equal temperament (only FS2 is not
+// the nearest whole Hz)
+#define SFE_QWIIC_BUZZER_CHECK_PITCH(note, midiNote)                                                                   \
+    static_assert(SFE_QWIIC_BUZZER_NOTE_##note - sfDevBuzzerMidiFrequency(midiNote) <= 1 &&                           \
+                      sfDevBuzzerMidiFrequency(midiNote) - SFE_QWIIC_BUZZER_NOTE_##note <= 1,                         \
+                  "SFE_QWIIC_BUZZER_NOTE_" #note " is not MIDI note " #midiNote)
+
+SFE_QWIIC_BUZZER_CHECK_PITCH(B0, 23);
+SFE_QWIIC_BUZZER_CHECK_PITCH(C1, 24);
+SFE_QWIIC_BUZZER_CHECK_PITCH(CS1, 25);
+SFE_QWIIC_BUZZER_CHECK_PITCH(D1, 26);
+SFE_QWIIC_BUZZER_CHECK_PITCH(DS1, 27);
+SFE_QWIIC_BUZZER_CHECK_PITCH(E1, 28);
+SFE_QWIIC_BUZZER_CHECK_PITCH(F1, 29);
+SFE_QWIIC_BUZZER_CHECK_PITCH(FS1, 30);
+SFE_QWIIC_BUZZER_CHECK_PITCH(G1, 31);
+SFE_QWIIC_BUZZER_CHECK_PITCH(GS1, 32);
+SFE_QWIIC_BUZZER_CHECK_PITCH(A1, 33);
+SFE_QWIIC_BUZZER_CHECK_PITCH(AS1, 34);
+SFE_QWIIC_BUZZER_CHECK_PITCH(B1, 35);
+SFE_QWIIC_BUZZER_CHECK_PITCH(C2, 36);
+SFE_QWIIC_BUZZER_CHECK_PITCH(CS2, 37);
+SFE_QWIIC_BUZZER_CHECK_PITCH(D2, 38);
+SFE_QWIIC_BUZZER_CHECK_PITCH(DS2, 39);
+SFE_QWIIC_BUZZER_CHECK_PITCH(E2, 40);
+SFE_QWIIC_BUZZER_CHECK_PITCH(F2, 41);
+SFE_QWIIC_BUZZER_CHECK_PITCH(FS2, 42);
+SFE_QWIIC_BUZZER_CHECK_PITCH(G2, 43);
+SFE_QWIIC_BUZZER_CHECK_PITCH(GS2, 44);
+SFE_QWIIC_BUZZER_CHECK_PITCH(A2, 45);
+SFE_QWIIC_BUZZER_CHECK_PITCH(AS2, 46);
+SFE_QWIIC_BUZZER_CHECK_PITCH(B2, 47);
+SFE_QWIIC_BUZZER_CHECK_PITCH(C3, 48);
+SFE_QWIIC_BUZZER_CHECK_PITCH(CS3, 49);
+SFE_QWIIC_BUZZER_CHECK_PITCH(D3, 50);
+SFE_QWIIC_BUZZER_CHECK_PITCH(DS3, 51);
+SFE_QWIIC_BUZZER_CHECK_PITCH(E3, 52);
+SFE_QWIIC_BUZZER_CHECK_PITCH(F3, 53);
+SFE_QWIIC_BUZZER_CHECK_PITCH(FS3, 54);
+SFE_QWIIC_BUZZER_CHECK_PITCH(G3, 55);
+SFE_QWIIC_BUZZER_CHECK_PITCH(GS3, 56);
+SFE_QWIIC_BUZZER_CHECK_PITCH(A3, 57);
+SFE_QWIIC_BUZZER_CHECK_PITCH(AS3, 58);
+SFE_QWIIC_BUZZER_CHECK_PITCH(B3, 59);
+SFE_QWIIC_BUZZER_CHECK_PITCH(C4, 60);
+SFE_QWIIC_BUZZER_CHECK_PITCH(CS4, 61);
+SFE_QWIIC_BUZZER_CHECK_PITCH(D4, 62);
+SFE_QWIIC_BUZZER_CHECK_PITCH(DS4, 63);
+SFE_QWIIC_BUZZER_CHECK_PITCH(E4, 64);
+SFE_QWIIC_BUZZER_CHECK_PITCH(F4, 65);
+SFE_QWIIC_BUZZER_CHECK_PITCH(FS4, 66);
+SFE_QWIIC_BUZZER_CHECK_PITCH(G4, 67);
+SFE_QWIIC_BUZZER_CHECK_PITCH(GS4, 68);
+SFE_QWIIC_BUZZER_CHECK_PITCH(A4, 69);
+SFE_QWIIC_BUZZER_CHECK_PITCH(AS4, 70);
+SFE_QWIIC_BUZZER_CHECK_PITCH(B4, 71);
+SFE_QWIIC_BUZZER_CHECK_PITCH(C5, 72);
+SFE_QWIIC_BUZZER_CHECK_PITCH(CS5, 73);
+SFE_QWIIC_BUZZER_CHECK_PITCH(D5, 74);
+SFE_QWIIC_BUZZER_CHECK_PITCH(DS5, 75);
+SFE_QWIIC_BUZZER_CHECK_PITCH(E5, 76);
+SFE_QWIIC_BUZZER_CHECK_PITCH(F5, 77);
+SFE_QWIIC_BUZZER_CHECK_PITCH(FS5, 78);
+SFE_QWIIC_BUZZER_CHECK_PITCH(G5, 79);
+SFE_QWIIC_BUZZER_CHECK_PITCH(GS5, 80);
+SFE_QWIIC_BUZZER_CHECK_PITCH(A5, 81);
+SFE_QWIIC_BUZZER_CHECK_PITCH(AS5, 82);
+SFE_QWIIC_BUZZER_CHECK_PITCH(B5, 83);
+SFE_QWIIC_BUZZER_CHECK_PITCH(C6, 84);
+SFE_QWIIC_BUZZER_CHECK_PITCH(CS6, 85);
+SFE_QWIIC_BUZZER_CHECK_PITCH(D6, 86);
+SFE_QWIIC_BUZZER_CHECK_PITCH(DS6, 87);
+SFE_QWIIC_BUZZER_CHECK_PITCH(E6, 88);
+SFE_QWIIC_BUZZER_CHECK_PITCH(F6, 89);
+SFE_QWIIC_BUZZER_CHECK_PITCH(FS6, 90);
+SFE_QWIIC_BUZZER_CHECK_PITCH(G6, 91);
+SFE_QWIIC_BUZZER_CHECK_PITCH(GS6, 92);
+SFE_QWIIC_BUZZER_CHECK_PITCH(A6, 93);
+SFE_QWIIC_BUZZER_CHECK_PITCH(AS6, 94);
+SFE_QWIIC_BUZZER_CHECK_PITCH(B6, 95);
+SFE_QWIIC_BUZZER_CHECK_PITCH(C7, 96);
+SFE_QWIIC_BUZZER_CHECK_PITCH(CS7, 97);
+SFE_QWIIC_BUZZER_CHECK_PITCH(D7, 98);
+SFE_QWIIC_BUZZER_CHECK_PITCH(DS7, 99);
+SFE_QWIIC_BUZZER_CHECK_PITCH(E7, 100);
+SFE_QWIIC_BUZZER_CHECK_PITCH(F7, 101);
+SFE_QWIIC_BUZZER_CHECK_PITCH(FS7, 102);
+SFE_QWIIC_BUZZER_CHECK_PITCH(G7, 103);
+SFE_QWIIC_BUZZER_CHECK_PITCH(GS7, 104);
+SFE_QWIIC_BUZZER_CHECK_PITCH(A7, 105);
+SFE_QWIIC_BUZZER_CHECK_PITCH(AS7, 106);
+SFE_QWIIC_BUZZER_CHECK_PITCH(B7, 107);
+SFE_QWIIC_BUZZER_CHECK_PITCH(C8, 108);
+SFE_QWIIC_BUZZER_CHECK_PITCH(CS8, 109);
+SFE_QWIIC_BUZZER_CHECK_PITCH(D8, 110);
+SFE_QWIIC_BUZZER_CHECK_PITCH(DS8, 111);
+
+#undef SFE_QWIIC_BUZZER_CHECK_PITCH
@@ -0,0 +1,319 @@
+/**
+ * @file    sfDevBuzzerVoices.cpp
+ * @brief   Implementation file for playing chords across several Qwiic Buzzers
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file contains the implementation of the sfDevBuzzerVoices and
+ *          sfDevBuzzerTrackPlayer classes.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ * Distributed as-is; no warranty is given.
+ */
+
+#include "sfDevBuzzerVoices.h"
+
+sfDevBuzzerVoices::sfDevBuzzerVoices() : _voices{}, _count{0}, _clock{0}, _steals{0}
+{
+}
+
+bool sfDevBuzzerVoices::add(sfDevBuzzer *buzzer)
+{
+    if (buzzer == nullptr || _count >= SFE_QWIIC_BUZZER_VOICE_COUNT)
+        return false;
+
+    sfDevBuzzerVoice &voice = _voices[_count++];
+    voice.buzzer = buzzer;
+    voice.frequency = 0;
+    voice.sounding = false;
+    voice.age = 0;
+    return true;
+}
+
+uint8_t sfDevBuzzerVoices::size()
+{
+    return _count;
+}
+
+sfTkError_t sfDevBuzzerVoices::noteOn(const uint16_t frequency, const uint8_t volume)
+{
+    if (_count == 0)
+        return ksfTkErrFail;
+
+    uint8_t index = allocate(frequency);
+    sfDevBuzzerVoice &voice = _voices[index];
+
+    // The buzzer's register cache drops whatever is already set, so reusing a
+    // voice at the same frequency only writes ACTIVE
+    sfTkError_t err = voice.buzzer->play(frequency, 0, volume);
+    if (err != ksfTkErrOk)
+    {
+        voice.frequency = 0;
+        voice.sounding = false;
+        return err;
+    }
+
+    voice.frequency = frequency;
+    voice.sounding = true;
+    voice.age = ++_clock;
+    return ksfTkErrOk;
+}
+
+sfTkError_t sfDevBuzzerVoices::noteOff(const uint16_t frequency)
+{
+    int8_t index = find(frequency);
+    if (index < 0)
+        return ksfTkErrOk;
+
+    // The voice keeps its frequency, for a later note to reuse
+    _voices[index].sounding = false;
+    _voices[index].age = ++_clock;
+    return _voices[index].buzzer->off();
+}
+
+sfTkError_t sfDevBuzzerVoices::chord(const uint16_t *frequencies, const uint8_t count, const uint8_t volume)
+{
+    sfTkError_t result = ksfTkErrOk;
+    sfTkError_t err;
+
+    // Stop the notes that are not part of the new chord
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        if (!_voices[i].sounding)
+            continue;
+
+        bool keep = false;
+        for (uint8_t n = 0; n < count && !keep; n++)
+            keep = _voices[i].frequency == frequencies[n];
+
+        if (!keep)
+        {
+            err = noteOff(_voices[i].frequency);
+            if (err != ksfTkErrOk && result == ksfTkErrOk)
+                result = err;
+        }
+    }
+
+    // Start the missing ones, up to the number of voices
+    uint8_t playing = 0;
+    for (uint8_t n = 0; n < count && playing < _count; n++)
+    {
+        playing++;
+        if (find(frequencies[n]) >= 0)
+            continue;
+
+        err = noteOn(frequencies[n], volume);
+        if (err != ksfTkErrOk && result == ksfTkErrOk)
+            result = err;
+    }
+    return result;
+}
+
+sfTkError_t sfDevBuzzerVoices::allOff()
+{
+    sfTkError_t result = ksfTkErrOk;
+
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        if (!_voices[i].sounding)
+            continue;
+
+        _voices[i].sounding = false;
+        sfTkError_t err = _voices[i].buzzer->off();
+        if (err != ksfTkErrOk && result == ksfTkErrOk)
+            result = err;
+    }
+    return result;
+}
+
+uint32_t sfDevBuzzerVoices::steals()
+{
+    return _steals;
+}
+
+uint8_t sfDevBuzzerVoices::allocate(const uint16_t frequency)
+{
+    // Already playing this note: play it again on the same voice
+    int8_t playing = find(frequency);
+    if (playing >= 0)
+        return playing;
+
+    int8_t sameFrequency = -1;
+    int8_t idle = -1;
+    int8_t oldest = -1;
+
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        const sfDevBuzzerVoice &voice = _voices[i];
+
+        if (voice.sounding)
+        {
+            if (oldest < 0 || (int32_t)(voice.age - _voices[oldest].age) < 0)
+                oldest = i;
+        }
+        else if (voice.frequency == frequency)
+            sameFrequency = i;
+        else if (idle < 0 || (int32_t)(voice.age - _voices[idle].age) < 0)
+            idle = i;
+    }
+
+    if (sameFrequency >= 0)
+        return sameFrequency;
+    if (idle >= 0)
+        return idle;
+
+    // Every voice is busy, steal the oldest note
+    _steals++;
+    return oldest;
+}
+
+int8_t sfDevBuzzerVoices::find(const uint16_t frequency)
+{
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        if (_voices[i].sounding && _voices[i].frequency == frequency)
+            return i;
+    }
+    return -1;
+}
+
+sfDevBuzzerTrackPlayer::sfDevBuzzerTrackPlayer()
+    : _tracks{}, _count{0}, _voices{nullptr}, _volume{4}, _playing{false}, _started{false}
+{
+}
+
+bool sfDevBuzzerTrackPlayer::addTrack(sfDevBuzzerMelodySource *source)
+{
+    if (source == nullptr || _count >= SFE_QWIIC_BUZZER_TRACK_COUNT)
+        return false;
+
+    _tracks[_count++].source = source;
+    return true;
+}
+
+void sfDevBuzzerTrackPlayer::clearTracks()
+{
+    _count = 0;
+    _playing = false;
+}
+
+uint8_t sfDevBuzzerTrackPlayer::trackCount()
+{
+    return _count;
+}
+
+void sfDevBuzzerTrackPlayer::start(sfDevBuzzerVoices *voices, const uint8_t volume, const uint16_t wholeNoteMs)
+{
+    _voices = voices;
+    _volume = volume;
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        _tracks[i].reader.start(_tracks[i].source, wholeNoteMs);
+        _tracks[i].frequency = 0;
+    }
+    _started = false;
+    _playing = voices != nullptr && _count > 0;
+}
+
+sfTkError_t sfDevBuzzerTrackPlayer::update(const uint32_t nowMs)
+{
+    if (!_playing)
+        return ksfTkErrOk;
+
+    // All tracks start together
+    if (!_started)
+    {
+        _started = true;
+        for (uint8_t i = 0; i < _count; i++)
+            _tracks[i].nextDue = nowMs;
+    }
+
+    sfTkError_t result = ksfTkErrOk;
+    sfTkError_t err;
+
+    // End the notes that are over first, so that their voices are free for
+    // the notes starting now
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        if (_tracks[i].frequency != 0 && (int32_t)(nowMs - _tracks[i].offDue) >= 0)
+        {
+            err = endNote(i);
+            if (err != ksfTkErrOk && result == ksfTkErrOk)
+                result = err;
+        }
+    }
+
+    bool playing = false;
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        Track &track = _tracks[i];
+
+        // Either the track is over, or its data is late
+        sfDevBuzzerMelodyEvent event;
+        if ((int32_t)(nowMs - track.nextDue) >= 0 && track.reader.read(event))
+        {
+            // A legato note ends as the next one starts
+            if (track.frequency != 0)
+            {
+                err = endNote(i);
+                if (err != ksfTkErrOk && result == ksfTkErrOk)
+                    result = err;
+            }
+
+            if (event.noteIndex != SFE_QWIIC_BUZZER_MELODY_REST)
+            {
+                uint16_t frequency = sfDevBuzzerNoteFrequency(event.noteIndex);
+                err = _voices->noteOn(frequency, _volume);
+                if (err == ksfTkErrOk)
+                    track.frequency = frequency;
+                else if (result == ksfTkErrOk)
+                    result = err;
+            }
+
+            // The next event is due a period after this one was, however late
+            // this update is
+            track.offDue = track.nextDue + event.soundMs;
+            track.nextDue += event.periodMs;
+        }
+
+        if (track.frequency != 0 || !track.reader.ended())
+            playing = true;
+    }
+
+    _playing = playing;
+    return result;
+}
+
+bool sfDevBuzzerTrackPlayer::isPlaying()
+{
+    return _playing;
+}
+
+sfTkError_t sfDevBuzzerTrackPlayer::stop()
+{
+    _playing = false;
+    for (uint8_t i = 0; i < _count; i++)
+        _tracks[i].frequency = 0;
+
+    if (_voices == nullptr)
+        return ksfTkErrOk;
+
+    return _voices->allOff();
+}
+
+sfTkError_t sfDevBuzzerTrackPlayer::endNote(const uint8_t index)
+{
+    uint16_t frequency = _tracks[index].frequency;
+    _tracks[index].frequency = 0;
+
+    // Another track still holds the note
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        if (_tracks[i].frequency == frequency)
+            return ksfTkErrOk;
+    }
+
+    return _voices->noteOff(frequency);
+}
@@ -0,0 +1,172 @@
+/**
+ * @file    sfDevBuzzerVoices.h
+ * @brief   Header file for playing chords across several Qwiic Buzzers
+ * @author  Pete Lewis \@SparkFun Electronics
+ * @date    February 2024
+ *
+ * @details This file declares the sfDevBuzzerVoices class. Each Qwiic Buzzer
+ *          plays one note at a time, so the class treats each buzzer as one
+ *          voice and assigns notes to them. A buzzer already set to the right
+ *          frequency is preferred, so the note only costs an ACTIVE write, and
+ *          when every buzzer is busy the oldest note is stolen.
+ *
+ *          It also declares sfDevBuzzerTrackPlayer, which plays several
+ *          melodies in the packed melody format at once, one per track, on the
+ *          voices of an sfDevBuzzerVoices.
+ *
+ * @copyright Copyright (c) 2024-2025 SparkFun Electronics. This project is released under the MIT License.
+ * @license   SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "sfDevBuzzer.h"
+#include "sfDevBuzzerMelody.h"
+
+#define SFE_QWIIC_BUZZER_VOICE_COUNT 16
+#define SFE_QWIIC_BUZZER_TRACK_COUNT 8
+
+/// @brief State of one voice (one buzzer)
+struct sfDevBuzzerVoice
+{
+    sfDevBuzzer *buzzer; ///< The buzzer playing this voice
+    uint16_t frequency;  ///< Frequency the buzzer is set to, 0 = unknown
+    bool sounding;       ///< True while a note is playing on this voice
+    uint32_t age;        ///< Event counter value when the voice was last used
+};
+
+class sfDevBuzzerVoices
+{
+  public:
+    /// @brief Default constructor
+    sfDevBuzzerVoices();
+
+    /// @brief Adds a buzzer as a voice. The buzzer must have been begun.
+    /// @param buzzer The buzzer to add
+    /// @return True if successful, false if there are already
+    /// SFE_QWIIC_BUZZER_VOICE_COUNT voices
+    bool add(sfDevBuzzer *buzzer);
+
+    /// @brief Gets the number of voices
+    /// @return Number of voices
+    uint8_t size();
+
+    /// @brief Starts a note on a voice. A voice already playing the same note
+    /// is reused, then an idle voice set to the same frequency, then the idle
+    /// voice unused for the longest time. If all voices are busy, the oldest
+    /// note is stolen.
+    /// @param frequency Frequency in Hz of the note
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t noteOn(const uint16_t frequency, const uint8_t volume = 4);
+
+    /// @brief Stops a note. Nothing is written if the note is not playing.
+    /// @param frequency Frequency in Hz of the note
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t noteOff(const uint16_t frequency);
+
+    /// @brief Plays a chord: notes of the chord already playing keep going,
+    /// other playing notes are stopped, and the missing ones are started.
+    /// Notes beyond the number of voices are not played.
+    /// @param frequencies Frequencies in Hz of the notes of the chord
+    /// @param count Number of notes
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @return 0 for succuss, or the first error met
+    sfTkError_t chord(const uint16_t *frequencies, const uint8_t count, const uint8_t volume = 4);
+
+    /// @brief Stops all notes
+    /// @return 0 for succuss, or the first error met
+    sfTkError_t allOff();
+
+    /// @brief Gets the number of notes stopped early to make room for new ones
+    /// @return Number of stolen voices
+    uint32_t steals();
+
+  private:
+    /// @brief Picks the voice for a new note
+    /// @param frequency Frequency in Hz of the note
+    /// @return Index of the voice
+    uint8_t allocate(const uint16_t frequency);
+
+    /// @brief Finds the voice playing a note
+    /// @param frequency Frequency in Hz of the note
+    /// @return Index of the voice, or -1 if the note is not playing
+    int8_t find(const uint16_t frequency);
+
+    sfDevBuzzerVoice _voices[SFE_QWIIC_BUZZER_VOICE_COUNT];
+    uint8_t _count;
+    uint32_t _clock;
+    uint32_t _steals;
+};
+
+/// @brief Non-blocking player for multi-track sequences: each track is a
+/// melody in the packed melody format, and all tracks play at the same time
+/// on the voices of an sfDevBuzzerVoices, which picks a buzzer for each note.
+/// A note played by two tracks at once takes one voice, and sounds until both
+/// have ended it.
+class sfDevBuzzerTrackPlayer
+{
+  public:
+    /// @brief Default constructor
+    sfDevBuzzerTrackPlayer();
+
+    /// @brief Adds a track, before start()
+    /// @param source Where to read the melody of the track from
+    /// @return True if successful, false if there are already
+    /// SFE_QWIIC_BUZZER_TRACK_COUNT tracks
+    bool addTrack(sfDevBuzzerMelodySource *source);
+
+    /// @brief Removes all tracks
+    void clearTracks();
+
+    /// @brief Gets the number of tracks
+    /// @return Number of tracks
+    uint8_t trackCount();
+
+    /// @brief Starts the tracks from their current position. They are played
+    /// by calling update() from your loop.
+    /// @param voices The voices to play on
+    /// @param volume Volume (4 settings; 0=off, 1=quiet... 4=loudest)
+    /// @param wholeNoteMs Length of a whole note in milliseconds (sets the tempo)
+    void start(sfDevBuzzerVoices *voices, const uint8_t volume = 4,
+               const uint16_t wholeNoteMs = SFE_QWIIC_BUZZER_MELODY_DEFAULT_WHOLE_NOTE);
+
+    /// @brief Advances the player. Only writes when a note starts or ends,
+    /// otherwise returns immediately.
+    /// @param nowMs Current time in milliseconds (e.g. millis())
+    /// @return 0 for succuss, or the first error met
+    sfTkError_t update(const uint32_t nowMs);
+
+    /// @brief Checks if the tracks are playing
+    /// @return True until every track has ended, and its last note with it
+    bool isPlaying();
+
+    /// @brief Stops all tracks, and their notes
+    /// @return 0 for succuss, or the first error met
+    sfTkError_t stop();
+
+  private:
+    /// @brief State of one track
+    struct Track
+    {
+        sfDevBuzzerMelodySource *source; ///< Where the melody is read from
+        sfDevBuzzerMelodyReader reader;  ///< Decodes the melody
+        uint16_t frequency;              ///< Frequency of the note sounding, 0 for none
+        uint32_t offDue;                 ///< Time at which the note sounding ends
+        uint32_t nextDue;                ///< Time at which the next event is due
+    };
+
+    /// @brief Ends the note of a track. The voice is only turned off if no
+    /// other track is playing the same note.
+    /// @param index Index of the track
+    /// @return 0 for succuss, negative for errors, positive for warnings
+    sfTkError_t endNote(const uint8_t index);
+
+    Track _tracks[SFE_QWIIC_BUZZER_TRACK_COUNT];
+    uint8_t _count;
+    sfDevBuzzerVoices *_voices;
+    uint8_t _volume;
+    bool _playing;
+    bool _started; // the first events have been played
+};